@@ -0,0 +1,711 @@
+//============================================================================
+// Name        : AdaptiveRadixTree.cpp
+// Author      : Dylan Harmon
+// Version     : 1.0
+// Description : Adaptive radix tree of bids keyed on bidId bytes
+//============================================================================
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ART_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "AdaptiveRadixTree.hpp"
+
+using namespace std;
+
+namespace {
+
+    // index of the lowest 1 bit in a non-zero mask
+    inline unsigned lowestSetBit(unsigned mask) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return static_cast<unsigned>(index);
+#else
+        return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+    }
+}
+
+/**
+ * Default constructor
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+AdaptiveRadixTree::AdaptiveRadixTree() {
+    root = nullptr;
+    size = 0;
+}
+
+/**
+ * Destructor
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+AdaptiveRadixTree::~AdaptiveRadixTree() {
+    destroy(root);
+}
+
+/**
+ * Insert a bid
+ *
+ * @return false if a bid with the same id is already present
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+bool AdaptiveRadixTree::Insert(Bid bid) {
+    Leaf* leaf = new Leaf();
+    leaf->type = LEAF;
+    leaf->count = 0;
+    leaf->prefixLength = 0;
+    leaf->bid = move(bid);
+    if (!insert(&root, leaf, 0)) {
+        delete leaf;
+        return false;
+    }
+    ++size;
+    return true;
+}
+
+/**
+ * Remove a bid
+ *
+ * @return true if a bid was removed
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+bool AdaptiveRadixTree::Remove(const string& bidId) {
+    if (!remove(&root, bidId, 0)) {
+        return false;
+    }
+    --size;
+    return true;
+}
+
+/**
+ * Search for a bid
+ *
+ * @return pointer to the stored bid, or nullptr if not found
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+const Bid* AdaptiveRadixTree::Find(const string& bidId) const {
+    const Node* node = root;
+    size_t depth = 0;
+    while (node != nullptr) {
+        if (node->type == LEAF) {
+            const Leaf* leaf = static_cast<const Leaf*>(node);
+            return leaf->bid.bidId == bidId ? &leaf->bid : nullptr;
+        }
+        // bytes past the stored prefix are checked at the leaf
+        if (node->prefixLength != 0) {
+            if (checkPrefix(node, bidId, depth) != min<size_t>(node->prefixLength, MAX_PREFIX)) {
+                return nullptr;
+            }
+            depth += node->prefixLength;
+        }
+        if (depth > bidId.size()) {
+            return nullptr; // ran past the end of the key
+        }
+        node = child(node, keyAt(bidId, depth));
+        ++depth;
+    }
+    return nullptr;
+}
+
+/**
+ * Search for a bid
+ *
+ * @return a copy of the matching bid, or an empty bid if not found
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+Bid AdaptiveRadixTree::Search(const string& bidId) const {
+    const Bid* bid = Find(bidId);
+    return bid != nullptr ? *bid : Bid();
+}
+
+/**
+ * Number of bids stored
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+size_t AdaptiveRadixTree::Size() const {
+    return size;
+}
+
+/**
+ * Bytes used by the index itself: every inner node plus the node header
+ * of every leaf. The bids are not counted.
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+size_t AdaptiveRadixTree::IndexBytes() const {
+    return root != nullptr ? nodeBytes(root) : 0;
+}
+
+/**
+ * Byte of the key at depth; the key ends with an implicit 0 byte
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+uint8_t AdaptiveRadixTree::keyAt(const string& id, size_t depth) {
+    return depth < id.size() ? static_cast<uint8_t>(id[depth]) : 0;
+}
+
+/**
+ * Child slot of an inner node for a key byte
+ *
+ * @return pointer to the slot, or nullptr if there is no such child
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+AdaptiveRadixTree::Node** AdaptiveRadixTree::childSlot(Node* node, uint8_t byte) {
+    switch (node->type) {
+    case NODE4: {
+        Node4* n = static_cast<Node4*>(node);
+        for (int i = 0; i < n->count; ++i) {
+            if (n->keys[i] == byte) {
+                return &n->child[i];
+            }
+        }
+        return nullptr;
+    }
+    case NODE16: {
+        Node16* n = static_cast<Node16*>(node);
+#if defined(ART_SSE2)
+        // compare all 16 key bytes at once
+        __m128i match = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(byte)),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(n->keys)));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(match)) & ((1u << n->count) - 1);
+        return mask != 0 ? &n->child[lowestSetBit(mask)] : nullptr;
+#else
+        for (int i = 0; i < n->count; ++i) {
+            if (n->keys[i] == byte) {
+                return &n->child[i];
+            }
+        }
+        return nullptr;
+#endif
+    }
+    case NODE48: {
+        Node48* n = static_cast<Node48*>(node);
+        return n->index[byte] != 0 ? &n->child[n->index[byte] - 1] : nullptr;
+    }
+    case NODE256: {
+        Node256* n = static_cast<Node256*>(node);
+        return n->child[byte] != nullptr ? &n->child[byte] : nullptr;
+    }
+    default:
+        return nullptr;
+    }
+}
+
+/**
+ * Child of an inner node for a key byte, or nullptr
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+const AdaptiveRadixTree::Node* AdaptiveRadixTree::child(const Node* node, uint8_t byte) {
+    Node** slot = childSlot(const_cast<Node*>(node), byte);
+    return slot != nullptr ? *slot : nullptr;
+}
+
+/**
+ * Leftmost leaf under node
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+const AdaptiveRadixTree::Leaf* AdaptiveRadixTree::minimum(const Node* node) {
+    while (node->type != LEAF) {
+        switch (node->type) {
+        case NODE4:
+            node = static_cast<const Node4*>(node)->child[0];
+            break;
+        case NODE16:
+            node = static_cast<const Node16*>(node)->child[0];
+            break;
+        case NODE48: {
+            const Node48* n = static_cast<const Node48*>(node);
+            int byte = 0;
+            while (n->index[byte] == 0) {
+                ++byte;
+            }
+            node = n->child[n->index[byte] - 1];
+            break;
+        }
+        case NODE256: {
+            const Node256* n = static_cast<const Node256*>(node);
+            int byte = 0;
+            while (n->child[byte] == nullptr) {
+                ++byte;
+            }
+            node = n->child[byte];
+            break;
+        }
+        }
+    }
+    return static_cast<const Leaf*>(node);
+}
+
+/**
+ * Number of stored prefix bytes of node that match id from depth
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+size_t AdaptiveRadixTree::checkPrefix(const Node* node, const string& id, size_t depth) {
+    size_t stored = min<size_t>(node->prefixLength, MAX_PREFIX);
+    size_t i = 0;
+    while (i < stored && node->prefix[i] == keyAt(id, depth + i)) {
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * Position of the first byte where node's full prefix and id differ,
+ * reading bytes past the stored ones from the node's leftmost leaf
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+size_t AdaptiveRadixTree::prefixMismatch(const Node* node, const string& id, size_t depth) {
+    size_t i = checkPrefix(node, id, depth);
+    if (i < MAX_PREFIX || node->prefixLength <= MAX_PREFIX) {
+        return i;
+    }
+    const string& leftmost = minimum(node)->bid.bidId;
+    while (i < node->prefixLength && keyAt(leftmost, depth + i) == keyAt(id, depth + i)) {
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * Add a child under a new key byte, growing node to the next layout
+ * when it is full
+ *
+ * @param ref the link that points at node; updated if node is replaced
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void AdaptiveRadixTree::addChild(Node** ref, Node* node, uint8_t byte, Node* added) {
+    switch (node->type) {
+    case NODE4: {
+        Node4* n = static_cast<Node4*>(node);
+        if (n->count < 4) {
+            int pos = 0;
+            while (pos < n->count && n->keys[pos] < byte) {
+                ++pos;
+            }
+            memmove(n->keys + pos + 1, n->keys + pos, n->count - pos);
+            memmove(n->child + pos + 1, n->child + pos, (n->count - pos) * sizeof(Node*));
+            n->keys[pos] = byte;
+            n->child[pos] = added;
+            ++n->count;
+            return;
+        }
+        Node16* grown = new Node16();
+        *static_cast<Node*>(grown) = *static_cast<Node*>(n);
+        grown->type = NODE16;
+        memcpy(grown->keys, n->keys, 4);
+        memcpy(grown->child, n->child, 4 * sizeof(Node*));
+        *ref = grown;
+        delete n;
+        addChild(ref, grown, byte, added);
+        return;
+    }
+    case NODE16: {
+        Node16* n = static_cast<Node16*>(node);
+        if (n->count < 16) {
+            int pos = 0;
+            while (pos < n->count && n->keys[pos] < byte) {
+                ++pos;
+            }
+            memmove(n->keys + pos + 1, n->keys + pos, n->count - pos);
+            memmove(n->child + pos + 1, n->child + pos, (n->count - pos) * sizeof(Node*));
+            n->keys[pos] = byte;
+            n->child[pos] = added;
+            ++n->count;
+            return;
+        }
+        Node48* grown = new Node48();
+        *static_cast<Node*>(grown) = *static_cast<Node*>(n);
+        grown->type = NODE48;
+        for (int i = 0; i < 16; ++i) {
+            grown->child[i] = n->child[i];
+            grown->index[n->keys[i]] = static_cast<uint8_t>(i + 1);
+        }
+        *ref = grown;
+        delete n;
+        addChild(ref, grown, byte, added);
+        return;
+    }
+    case NODE48: {
+        Node48* n = static_cast<Node48*>(node);
+        if (n->count < 48) {
+            int pos = 0;
+            while (n->child[pos] != nullptr) {
+                ++pos;
+            }
+            n->child[pos] = added;
+            n->index[byte] = static_cast<uint8_t>(pos + 1);
+            ++n->count;
+            return;
+        }
+        Node256* grown = new Node256();
+        *static_cast<Node*>(grown) = *static_cast<Node*>(n);
+        grown->type = NODE256;
+        for (int b = 0; b < 256; ++b) {
+            if (n->index[b] != 0) {
+                grown->child[b] = n->child[n->index[b] - 1];
+            }
+        }
+        *ref = grown;
+        delete n;
+        addChild(ref, grown, byte, added);
+        return;
+    }
+    case NODE256: {
+        Node256* n = static_cast<Node256*>(node);
+        n->child[byte] = added;
+        ++n->count;
+        return;
+    }
+    }
+}
+
+/**
+ * Drop the child in slot, shrinking node to the next smaller layout
+ * once it is sparse enough, and collapsing a Node4 left with one child
+ * into that child
+ *
+ * @param ref the link that points at node; updated if node is replaced
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void AdaptiveRadixTree::removeChild(Node** ref, Node* node, uint8_t byte, Node** slot) {
+    switch (node->type) {
+    case NODE4: {
+        Node4* n = static_cast<Node4*>(node);
+        int pos = static_cast<int>(slot - n->child);
+        memmove(n->keys + pos, n->keys + pos + 1, n->count - pos - 1);
+        memmove(n->child + pos, n->child + pos + 1, (n->count - pos - 1) * sizeof(Node*));
+        --n->count;
+        if (n->count == 1) {
+            Node* only = n->child[0];
+            if (only->type != LEAF) {
+                // only's prefix becomes n's prefix + the branch byte + only's prefix
+                size_t length = n->prefixLength;
+                uint8_t merged[MAX_PREFIX];
+                memcpy(merged, n->prefix, min<size_t>(length, MAX_PREFIX));
+                if (length < MAX_PREFIX) {
+                    merged[length++] = n->keys[0];
+                }
+                if (length < MAX_PREFIX) {
+                    size_t extra = min<size_t>(only->prefixLength, MAX_PREFIX - length);
+                    memcpy(merged + length, only->prefix, extra);
+                    length += extra;
+                }
+                memcpy(only->prefix, merged, min<size_t>(length, MAX_PREFIX));
+                only->prefixLength += n->prefixLength + 1;
+            }
+            *ref = only;
+            delete n;
+        }
+        return;
+    }
+    case NODE16: {
+        Node16* n = static_cast<Node16*>(node);
+        int pos = static_cast<int>(slot - n->child);
+        memmove(n->keys + pos, n->keys + pos + 1, n->count - pos - 1);
+        memmove(n->child + pos, n->child + pos + 1, (n->count - pos - 1) * sizeof(Node*));
+        --n->count;
+        if (n->count == 3) {
+            Node4* shrunk = new Node4();
+            *static_cast<Node*>(shrunk) = *static_cast<Node*>(n);
+            shrunk->type = NODE4;
+            memcpy(shrunk->keys, n->keys, 3);
+            memcpy(shrunk->child, n->child, 3 * sizeof(Node*));
+            *ref = shrunk;
+            delete n;
+        }
+        return;
+    }
+    case NODE48: {
+        Node48* n = static_cast<Node48*>(node);
+        n->child[n->index[byte] - 1] = nullptr;
+        n->index[byte] = 0;
+        --n->count;
+        if (n->count == 12) {
+            Node16* shrunk = new Node16();
+            *static_cast<Node*>(shrunk) = *static_cast<Node*>(n);
+            shrunk->type = NODE16;
+            int pos = 0;
+            for (int b = 0; b < 256; ++b) {
+                if (n->index[b] != 0) {
+                    shrunk->keys[pos] = static_cast<uint8_t>(b);
+                    shrunk->child[pos] = n->child[n->index[b] - 1];
+                    ++pos;
+                }
+            }
+            *ref = shrunk;
+            delete n;
+        }
+        return;
+    }
+    case NODE256: {
+        Node256* n = static_cast<Node256*>(node);
+        n->child[byte] = nullptr;
+        --n->count;
+        if (n->count == 37) {
+            Node48* shrunk = new Node48();
+            *static_cast<Node*>(shrunk) = *static_cast<Node*>(n);
+            shrunk->type = NODE48;
+            int pos = 0;
+            for (int b = 0; b < 256; ++b) {
+                if (n->child[b] != nullptr) {
+                    shrunk->child[pos] = n->child[b];
+                    shrunk->index[b] = static_cast<uint8_t>(pos + 1);
+                    ++pos;
+                }
+            }
+            *ref = shrunk;
+            delete n;
+        }
+        return;
+    }
+    }
+}
+
+/**
+ * Free a subtree; recursion depth is bounded by the id length
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void AdaptiveRadixTree::destroy(Node* node) {
+    if (node == nullptr) {
+        return;
+    }
+    switch (node->type) {
+    case LEAF:
+        delete static_cast<Leaf*>(node);
+        return;
+    case NODE4: {
+        Node4* n = static_cast<Node4*>(node);
+        for (int i = 0; i < n->count; ++i) {
+            destroy(n->child[i]);
+        }
+        delete n;
+        return;
+    }
+    case NODE16: {
+        Node16* n = static_cast<Node16*>(node);
+        for (int i = 0; i < n->count; ++i) {
+            destroy(n->child[i]);
+        }
+        delete n;
+        return;
+    }
+    case NODE48: {
+        Node48* n = static_cast<Node48*>(node);
+        for (int i = 0; i < 48; ++i) {
+            destroy(n->child[i]);
+        }
+        delete n;
+        return;
+    }
+    case NODE256: {
+        Node256* n = static_cast<Node256*>(node);
+        for (int i = 0; i < 256; ++i) {
+            destroy(n->child[i]);
+        }
+        delete n;
+        return;
+    }
+    }
+}
+
+/**
+ * Index bytes used by a subtree, see IndexBytes()
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+size_t AdaptiveRadixTree::nodeBytes(const Node* node) {
+    size_t bytes = 0;
+    switch (node->type) {
+    case LEAF:
+        return sizeof(Node);
+    case NODE4: {
+        const Node4* n = static_cast<const Node4*>(node);
+        bytes = sizeof(Node4);
+        for (int i = 0; i < n->count; ++i) {
+            bytes += nodeBytes(n->child[i]);
+        }
+        break;
+    }
+    case NODE16: {
+        const Node16* n = static_cast<const Node16*>(node);
+        bytes = sizeof(Node16);
+        for (int i = 0; i < n->count; ++i) {
+            bytes += nodeBytes(n->child[i]);
+        }
+        break;
+    }
+    case NODE48: {
+        const Node48* n = static_cast<const Node48*>(node);
+        bytes = sizeof(Node48);
+        for (int i = 0; i < 48; ++i) {
+            if (n->child[i] != nullptr) {
+                bytes += nodeBytes(n->child[i]);
+            }
+        }
+        break;
+    }
+    case NODE256: {
+        const Node256* n = static_cast<const Node256*>(node);
+        bytes = sizeof(Node256);
+        for (int i = 0; i < 256; ++i) {
+            if (n->child[i] != nullptr) {
+                bytes += nodeBytes(n->child[i]);
+            }
+        }
+        break;
+    }
+    }
+    return bytes;
+}
+
+/**
+ * Insert leaf into the subtree at ref, splitting a leaf or a prefix
+ * where the new key branches off
+ *
+ * @return false if the id is already present
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+bool AdaptiveRadixTree::insert(Node** ref, Leaf* leaf, size_t depth) {
+    Node* node = *ref;
+    const string& id = leaf->bid.bidId;
+    if (node == nullptr) {
+        *ref = leaf;
+        return true;
+    }
+
+    // two keys meet: branch where they first differ
+    if (node->type == LEAF) {
+        const string& existing = static_cast<Leaf*>(node)->bid.bidId;
+        if (existing == id) {
+            return false;
+        }
+        size_t end = max(existing.size(), id.size()) + 1;
+        size_t common = 0;
+        while (depth + common < end && keyAt(existing, depth + common) == keyAt(id, depth + common)) {
+            ++common;
+        }
+        if (depth + common == end) {
+            return false; // ids that differ only by trailing 0 bytes
+        }
+        Node4* split = new Node4();
+        split->type = NODE4;
+        split->prefixLength = static_cast<uint32_t>(common);
+        for (size_t i = 0; i < min<size_t>(common, MAX_PREFIX); ++i) {
+            split->prefix[i] = keyAt(id, depth + i);
+        }
+        *ref = split;
+        addChild(ref, split, keyAt(existing, depth + common), node);
+        addChild(ref, split, keyAt(id, depth + common), leaf);
+        return true;
+    }
+
+    // the key leaves the compressed prefix: split it
+    if (node->prefixLength != 0) {
+        size_t mismatch = prefixMismatch(node, id, depth);
+        if (mismatch < node->prefixLength) {
+            Node4* split = new Node4();
+            split->type = NODE4;
+            split->prefixLength = static_cast<uint32_t>(mismatch);
+            memcpy(split->prefix, node->prefix, min<size_t>(mismatch, MAX_PREFIX));
+            *ref = split;
+            if (node->prefixLength <= MAX_PREFIX) {
+                addChild(ref, split, node->prefix[mismatch], node);
+                node->prefixLength -= static_cast<uint32_t>(mismatch + 1);
+                memmove(node->prefix, node->prefix + mismatch + 1, node->prefixLength);
+            }
+            else {
+                // the stored bytes run out; recover the rest from a leaf
+                const string& leftmost = minimum(node)->bid.bidId;
+                addChild(ref, split, keyAt(leftmost, depth + mismatch), node);
+                node->prefixLength -= static_cast<uint32_t>(mismatch + 1);
+                for (size_t i = 0; i < min<size_t>(node->prefixLength, MAX_PREFIX); ++i) {
+                    node->prefix[i] = keyAt(leftmost, depth + mismatch + 1 + i);
+                }
+            }
+            addChild(ref, split, keyAt(id, depth + mismatch), leaf);
+            return true;
+        }
+        depth += node->prefixLength;
+    }
+
+    Node** next = childSlot(node, keyAt(id, depth));
+    if (next != nullptr) {
+        return insert(next, leaf, depth + 1);
+    }
+    addChild(ref, node, keyAt(id, depth), leaf);
+    return true;
+}
+
+/**
+ * Remove bidId from the subtree at ref
+ *
+ * @return true if a bid was removed
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+bool AdaptiveRadixTree::remove(Node** ref, const string& bidId, size_t depth) {
+    Node* node = *ref;
+    if (node == nullptr) {
+        return false;
+    }
+    if (node->type == LEAF) {
+        // only reached when the whole tree is one leaf
+        if (static_cast<Leaf*>(node)->bid.bidId != bidId) {
+            return false;
+        }
+        delete static_cast<Leaf*>(node);
+        *ref = nullptr;
+        return true;
+    }
+    if (node->prefixLength != 0) {
+        if (checkPrefix(node, bidId, depth) != min<size_t>(node->prefixLength, MAX_PREFIX)) {
+            return false;
+        }
+        depth += node->prefixLength;
+    }
+    if (depth > bidId.size()) {
+        return false;
+    }
+
+    uint8_t byte = keyAt(bidId, depth);
+    Node** slot = childSlot(node, byte);
+    if (slot == nullptr) {
+        return false;
+    }
+    if ((*slot)->type == LEAF) {
+        Leaf* leaf = static_cast<Leaf*>(*slot);
+        if (leaf->bid.bidId != bidId) {
+            return false;
+        }
+        removeChild(ref, node, byte, slot);
+        delete leaf;
+        return true;
+    }
+    return remove(slot, bidId, depth + 1);
+}
@@ -0,0 +1,201 @@
+//============================================================================
+// Name        : AdaptiveRadixTree.hpp
+// Author      : Dylan Harmon
+// Version     : 1.0
+// Description : Adaptive radix tree of bids keyed on bidId bytes
+//============================================================================
+
+#ifndef ADAPTIVERADIXTREE_HPP_
+#define ADAPTIVERADIXTREE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "Bid.hpp"
+
+//============================================================================
+// Adaptive Radix Tree class definition
+//============================================================================
+
+/**
+ * Ordered bid index that branches on one byte of the id per level.
+ *
+ * Inner nodes grow and shrink between four layouts as their fan-out
+ * changes: Node4 and Node16 keep sorted key bytes beside their children
+ * (Node16 is searched with one SSE2 compare), Node48 maps all 256 bytes
+ * to 48 child slots, and Node256 indexes children directly. Runs of
+ * single-child levels are collapsed into a prefix stored in the node;
+ * up to MAX_PREFIX bytes are kept and longer prefixes are checked
+ * against the leaf at the end of the search.
+ *
+ * Lookup cost depends on the id length, not on the number of bids. Keys
+ * are treated as ending in a 0 byte, so an id that is a prefix of
+ * another (e.g. "98" and "981") still gets its own leaf; ids must not
+ * contain a 0 byte themselves. Ids are unique.
+ */
+class AdaptiveRadixTree {
+
+private:
+    static const unsigned MAX_PREFIX = 8;
+
+    enum NodeType : uint8_t { LEAF, NODE4, NODE16, NODE48, NODE256 };
+
+    struct Node {
+        uint8_t type;
+        uint16_t count;                 // children in use
+        uint32_t prefixLength;          // bytes skipped before branching
+        uint8_t prefix[MAX_PREFIX];     // the first of those bytes
+    };
+
+    struct Leaf : Node {
+        Bid bid;
+    };
+
+    struct Node4 : Node {
+        uint8_t keys[4];                // sorted
+        Node* child[4];
+    };
+
+    struct Node16 : Node {
+        uint8_t keys[16];               // sorted
+        Node* child[16];
+    };
+
+    struct Node48 : Node {
+        uint8_t index[256];             // byte -> child slot + 1, 0 when absent
+        Node* child[48];
+    };
+
+    struct Node256 : Node {
+        Node* child[256];
+    };
+
+    Node* root;
+    size_t size;
+
+    static uint8_t keyAt(const std::string& id, size_t depth);
+    static Node** childSlot(Node* node, uint8_t byte);
+    static const Node* child(const Node* node, uint8_t byte);
+    static const Leaf* minimum(const Node* node);
+    static size_t checkPrefix(const Node* node, const std::string& id, size_t depth);
+    static size_t prefixMismatch(const Node* node, const std::string& id, size_t depth);
+    static void addChild(Node** ref, Node* node, uint8_t byte, Node* added);
+    static void removeChild(Node** ref, Node* node, uint8_t byte, Node** slot);
+    static void destroy(Node* node);
+    static size_t nodeBytes(const Node* node);
+
+    bool insert(Node** ref, Leaf* leaf, size_t depth);
+    bool remove(Node** ref, const std::string& bidId, size_t depth);
+
+    /**
+     * Visit every bid under node in id order; recursion depth is bounded
+     * by the id length
+     */
+    template <typename Visitor>
+    static size_t visitAll(const Node* node, Visitor& visit) {
+        size_t visited = 0;
+        switch (node->type) {
+        case LEAF:
+            visit(static_cast<const Leaf*>(node)->bid);
+            return 1;
+        case NODE4: {
+            const Node4* n = static_cast<const Node4*>(node);
+            for (int i = 0; i < n->count; ++i) {
+                visited += visitAll(n->child[i], visit);
+            }
+            break;
+        }
+        case NODE16: {
+            const Node16* n = static_cast<const Node16*>(node);
+            for (int i = 0; i < n->count; ++i) {
+                visited += visitAll(n->child[i], visit);
+            }
+            break;
+        }
+        case NODE48: {
+            const Node48* n = static_cast<const Node48*>(node);
+            for (int byte = 0; byte < 256; ++byte) {
+                if (n->index[byte] != 0) {
+                    visited += visitAll(n->child[n->index[byte] - 1], visit);
+                }
+            }
+            break;
+        }
+        case NODE256: {
+            const Node256* n = static_cast<const Node256*>(node);
+            for (int byte = 0; byte < 256; ++byte) {
+                if (n->child[byte] != nullptr) {
+                    visited += visitAll(n->child[byte], visit);
+                }
+            }
+            break;
+        }
+        }
+        return visited;
+    }
+
+public:
+    AdaptiveRadixTree();
+    virtual ~AdaptiveRadixTree();
+    AdaptiveRadixTree(const AdaptiveRadixTree&) = delete;
+    AdaptiveRadixTree& operator=(const AdaptiveRadixTree&) = delete;
+
+    bool Insert(Bid bid);
+    bool Remove(const std::string& bidId);
+    const Bid* Find(const std::string& bidId) const;
+    Bid Search(const std::string& bidId) const;
+    size_t Size() const;
+    size_t IndexBytes() const;
+
+    /**
+     * Visit every bid in bidId order
+     *
+     * @param visit callable taking const Bid&
+     */
+    template <typename Visitor>
+    void ForEach(Visitor visit) const {
+        if (root != nullptr) {
+            visitAll(root, visit);
+        }
+    }
+
+    /**
+     * Visit, in bidId order, every bid whose id starts with prefix. Only
+     * the path to the prefix and the matching subtree are touched.
+     *
+     * @param visit callable taking const Bid&
+     * @return number of bids visited
+     */
+    template <typename Visitor>
+    size_t PrefixScan(const std::string& prefix, Visitor visit) const {
+        const Node* node = root;
+        size_t depth = 0;
+        while (node != nullptr) {
+            if (node->type == LEAF) {
+                const Bid& bid = static_cast<const Leaf*>(node)->bid;
+                if (bid.bidId.compare(0, prefix.size(), prefix) != 0) {
+                    return 0;
+                }
+                visit(bid);
+                return 1;
+            }
+            // match the node's compressed prefix against what is left of ours
+            for (size_t i = 0; i < node->prefixLength && depth + i < prefix.size(); ++i) {
+                uint8_t byte = i < MAX_PREFIX ? node->prefix[i] : keyAt(minimum(node)->bid.bidId, depth + i);
+                if (byte != static_cast<uint8_t>(prefix[depth + i])) {
+                    return 0;
+                }
+            }
+            depth += node->prefixLength;
+            if (depth >= prefix.size()) {
+                return visitAll(node, visit); // everything below shares the prefix
+            }
+            node = child(node, static_cast<uint8_t>(prefix[depth]));
+            ++depth;
+        }
+        return 0;
+    }
+};
+
+#endif /* ADAPTIVERADIXTREE_HPP_ */
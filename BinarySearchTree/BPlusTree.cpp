@@ -0,0 +1,507 @@
+//============================================================================
+// Name        : BPlusTree.cpp
+// Author      : Dylan Harmon
+// Version     : 1.0
+// Description : In-memory B+ tree of bids keyed on bidId
+//============================================================================
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+#include "BPlusTree.hpp"
+
+using namespace std;
+
+/**
+ * Default constructor
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+BPlusTree::BPlusTree() {
+    root = nullptr;
+    head = nullptr;
+    tail = nullptr;
+    size = 0;
+}
+
+/**
+ * Destructor
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+BPlusTree::~BPlusTree() {
+    destroy(root);
+}
+
+/**
+ * Free a subtree; recursion depth is the tree height, which stays tiny
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void BPlusTree::destroy(Node* node) {
+    if (node == nullptr) {
+        return;
+    }
+    if (node->leaf) {
+        delete static_cast<Leaf*>(node);
+        return;
+    }
+    Inner* inner = static_cast<Inner*>(node);
+    for (int i = 0; i <= inner->count; ++i) {
+        destroy(inner->child[i]);
+    }
+    delete inner;
+}
+
+/**
+ * Full id of key i in a node
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+string_view BPlusTree::keyId(const Node* node, int i) const {
+    if (node->leaf) {
+        return values[static_cast<const Leaf*>(node)->slot[i]].bidId;
+    }
+    return string_view(separators.data() + static_cast<const Inner*>(node)->id[i], node->length[i]);
+}
+
+/**
+ * Copy a separator id into the arena
+ *
+ * @return offset of the copy
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+uint32_t BPlusTree::addSeparator(const string& id) {
+    if (id.size() > numeric_limits<uint32_t>::max() - separators.size()) {
+        throw length_error("BPlusTree: separator arena is full");
+    }
+    uint32_t offset = static_cast<uint32_t>(separators.size());
+    separators.insert(separators.end(), id.begin(), id.end());
+    return offset;
+}
+
+/**
+ * Compare key i of a node against a search key
+ *
+ * @return <0, 0 or >0 as key i is less than, equal to or greater than key
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+int BPlusTree::compareAt(const Node* node, int i, const BidKey& key, const string& id) const {
+    // settle on the prefix array alone whenever possible
+    if (node->prefix[i] != key.prefix) {
+        return node->prefix[i] < key.prefix ? -1 : 1;
+    }
+    BidKey nodeKey;
+    nodeKey.prefix = node->prefix[i];
+    nodeKey.length = node->length[i];
+    if (nodeKey.exact() && key.exact()) {
+        return compareBidIds(nodeKey, id, key, id);
+    }
+    return keyId(node, i).compare(id);
+}
+
+/**
+ * Number of keys in a node strictly less than key
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+int BPlusTree::lowerBound(const Node* node, const BidKey& key, const string& id) const {
+    int i = 0;
+    while (i < node->count && compareAt(node, i, key, id) < 0) {
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * Number of keys in a node less than or equal to key
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+int BPlusTree::upperBound(const Node* node, const BidKey& key, const string& id) const {
+    int i = 0;
+    while (i < node->count && compareAt(node, i, key, id) <= 0) {
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * Find the first key not less than key
+ *
+ * @param path if not null, filled with the inner nodes and child indexes
+ *             followed from the root to the returned leaf
+ * @param pos set to the position in the returned leaf
+ * @return the leaf holding that key, or nullptr if every key is smaller
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+BPlusTree::Leaf* BPlusTree::findLeaf(const BidKey& key, const string& id, vector<Step>* path, int& pos) const {
+    Node* node = root;
+    if (node == nullptr) {
+        return nullptr;
+    }
+    while (!node->leaf) {
+        Inner* inner = static_cast<Inner*>(node);
+        int i = lowerBound(inner, key, id);
+        if (path != nullptr) {
+            path->push_back(Step{ inner, i });
+        }
+        node = inner->child[i];
+    }
+
+    Leaf* leaf = static_cast<Leaf*>(node);
+    pos = lowerBound(leaf, key, id);
+
+    // equal keys can start the next leaf when a run of duplicates was split
+    while (leaf != nullptr && pos == leaf->count) {
+        if (path != nullptr) {
+            // advance the recorded path to the next leaf
+            while (!path->empty() && path->back().index == path->back().node->count) {
+                path->pop_back();
+            }
+            if (path->empty()) {
+                return nullptr;
+            }
+            ++path->back().index;
+            Node* next = path->back().node->child[path->back().index];
+            while (!next->leaf) {
+                path->push_back(Step{ static_cast<Inner*>(next), 0 });
+                next = static_cast<Inner*>(next)->child[0];
+            }
+        }
+        leaf = leaf->next;
+        pos = 0;
+    }
+    return leaf;
+}
+
+/**
+ * Split the full child i of parent into two half-full nodes and insert
+ * the separator into parent, which must not be full
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void BPlusTree::splitChild(Inner* parent, int i) {
+    Node* left = parent->child[i];
+    const int mid = ORDER / 2;
+    Node* right;
+    uint32_t separatorId;
+    uint64_t separatorPrefix;
+    uint32_t separatorLength;
+
+    if (left->leaf) {
+        // leaves keep every key; the right half's first key is copied up
+        Leaf* l = static_cast<Leaf*>(left);
+        separatorId = addSeparator(values[l->slot[mid]].bidId);
+        Leaf* r = new Leaf();
+        r->leaf = true;
+        r->count = ORDER - mid;
+        copy(l->prefix + mid, l->prefix + ORDER, r->prefix);
+        copy(l->length + mid, l->length + ORDER, r->length);
+        copy(l->slot + mid, l->slot + ORDER, r->slot);
+        l->count = mid;
+
+        // link the new leaf into the chain
+        r->prev = l;
+        r->next = l->next;
+        if (l->next != nullptr) {
+            l->next->prev = r;
+        }
+        else {
+            tail = r;
+        }
+        l->next = r;
+
+        separatorPrefix = r->prefix[0];
+        separatorLength = r->length[0];
+        right = r;
+    }
+    else {
+        // inner nodes move the middle separator up
+        Inner* l = static_cast<Inner*>(left);
+        Inner* r = new Inner();
+        r->leaf = false;
+        r->count = ORDER - mid - 1;
+        copy(l->prefix + mid + 1, l->prefix + ORDER, r->prefix);
+        copy(l->length + mid + 1, l->length + ORDER, r->length);
+        copy(l->id + mid + 1, l->id + ORDER, r->id);
+        copy(l->child + mid + 1, l->child + ORDER + 1, r->child);
+        l->count = mid;
+
+        separatorPrefix = l->prefix[mid];
+        separatorLength = l->length[mid];
+        separatorId = l->id[mid];
+        right = r;
+    }
+
+    // open a gap at i in parent's keys and at i + 1 in its children
+    copy_backward(parent->prefix + i, parent->prefix + parent->count, parent->prefix + parent->count + 1);
+    copy_backward(parent->length + i, parent->length + parent->count, parent->length + parent->count + 1);
+    copy_backward(parent->id + i, parent->id + parent->count, parent->id + parent->count + 1);
+    copy_backward(parent->child + i + 1, parent->child + parent->count + 1, parent->child + parent->count + 2);
+
+    parent->prefix[i] = separatorPrefix;
+    parent->length[i] = separatorLength;
+    parent->id[i] = separatorId;
+    parent->child[i + 1] = right;
+    ++parent->count;
+}
+
+/**
+ * Unlink the empty node at the end of path from its parent, freeing any
+ * ancestors that become empty and collapsing a root with a single child
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void BPlusTree::removeChild(vector<Step>& path) {
+    while (!path.empty()) {
+        Inner* parent = path.back().node;
+        int i = path.back().index;
+        path.pop_back();
+
+        if (parent->count > 0) {
+            // drop child i and the separator beside it
+            int k = i > 0 ? i - 1 : 0;
+            copy(parent->prefix + k + 1, parent->prefix + parent->count, parent->prefix + k);
+            copy(parent->length + k + 1, parent->length + parent->count, parent->length + k);
+            copy(parent->id + k + 1, parent->id + parent->count, parent->id + k);
+            copy(parent->child + i + 1, parent->child + parent->count + 1, parent->child + i);
+            --parent->count;
+            break;
+        }
+
+        // parent only had this child, so it is empty too
+        if (parent == root) {
+            delete parent;
+            root = nullptr;
+            return;
+        }
+        delete parent;
+    }
+
+    // a root with one child adds a level for nothing
+    while (root != nullptr && !root->leaf && root->count == 0) {
+        Inner* old = static_cast<Inner*>(root);
+        root = old->child[0];
+        delete old;
+    }
+    if (root == nullptr || root->leaf) {
+        separators.clear(); // no inner node is left to refer to it
+    }
+}
+
+/**
+ * Traverse the leaves in order and print every bid
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void BPlusTree::InOrder() {
+    ForEach([](const Bid& bid) {
+        cout << bid.bidId << ": "
+            << bid.title << " | "
+            << bid.amount << " | "
+            << bid.fund << endl;
+    });
+}
+
+/**
+ * Insert a bid
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void BPlusTree::Insert(Bid bid) {
+    BidKey key(bid.bidId);
+
+    // store the bid out of line, reusing a freed slot if there is one
+    uint32_t slot;
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+        values[slot] = move(bid);
+    }
+    else {
+        slot = static_cast<uint32_t>(values.size());
+        values.push_back(move(bid));
+    }
+    const string& id = values[slot].bidId;
+
+    if (root == nullptr) {
+        Leaf* leaf = new Leaf();
+        leaf->leaf = true;
+        leaf->count = 0;
+        leaf->prev = nullptr;
+        leaf->next = nullptr;
+        root = head = tail = leaf;
+    }
+
+    // grow a level when the root is full
+    if (root->count == ORDER) {
+        Inner* newRoot = new Inner();
+        newRoot->leaf = false;
+        newRoot->count = 0;
+        newRoot->child[0] = root;
+        root = newRoot;
+        splitChild(newRoot, 0);
+    }
+
+    // descend, splitting full children before entering them
+    Node* node = root;
+    while (!node->leaf) {
+        Inner* inner = static_cast<Inner*>(node);
+        int i = upperBound(inner, key, id);
+        if (inner->child[i]->count == ORDER) {
+            splitChild(inner, i);
+            if (compareAt(inner, i, key, id) <= 0) {
+                ++i;
+            }
+        }
+        node = inner->child[i];
+    }
+
+    // duplicates go after equal keys
+    Leaf* leaf = static_cast<Leaf*>(node);
+    int pos = upperBound(leaf, key, id);
+    copy_backward(leaf->prefix + pos, leaf->prefix + leaf->count, leaf->prefix + leaf->count + 1);
+    copy_backward(leaf->length + pos, leaf->length + leaf->count, leaf->length + leaf->count + 1);
+    copy_backward(leaf->slot + pos, leaf->slot + leaf->count, leaf->slot + leaf->count + 1);
+    leaf->prefix[pos] = key.prefix;
+    leaf->length[pos] = key.length;
+    leaf->slot[pos] = slot;
+    ++leaf->count;
+    ++size;
+}
+
+/**
+ * Remove the first bid with a matching id
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void BPlusTree::Remove(string bidId) {
+    BidKey key(bidId);
+    vector<Step> path;
+    int pos = 0;
+    Leaf* leaf = findLeaf(key, bidId, &path, pos);
+    if (leaf == nullptr || compareAt(leaf, pos, key, bidId) != 0) {
+        return; // not found, nothing to remove
+    }
+
+    // release the value slot
+    uint32_t slot = leaf->slot[pos];
+    values[slot] = Bid();
+    freeSlots.push_back(slot);
+
+    copy(leaf->prefix + pos + 1, leaf->prefix + leaf->count, leaf->prefix + pos);
+    copy(leaf->length + pos + 1, leaf->length + leaf->count, leaf->length + pos);
+    copy(leaf->slot + pos + 1, leaf->slot + leaf->count, leaf->slot + pos);
+    --leaf->count;
+    --size;
+
+    if (leaf->count > 0 || leaf == root) {
+        return;
+    }
+
+    // unlink and free the empty leaf
+    if (leaf->prev != nullptr) {
+        leaf->prev->next = leaf->next;
+    }
+    else {
+        head = leaf->next;
+    }
+    if (leaf->next != nullptr) {
+        leaf->next->prev = leaf->prev;
+    }
+    else {
+        tail = leaf->prev;
+    }
+    delete leaf;
+    removeChild(path);
+}
+
+/**
+ * Search for a bid
+ *
+ * @return the first bid with a matching id, or an empty bid
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+Bid BPlusTree::Search(string bidId) {
+    BidKey key(bidId);
+    int pos = 0;
+    Leaf* leaf = findLeaf(key, bidId, nullptr, pos);
+    if (leaf != nullptr && compareAt(leaf, pos, key, bidId) == 0) {
+        return values[leaf->slot[pos]];
+    }
+    return Bid();
+}
+
+/**
+ * Copy the separator ids of a subtree into a new arena, depth first,
+ * pointing each inner node at its copies
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void BPlusTree::compactSeparators(Node* node, vector<char>& compacted) {
+    if (node == nullptr || node->leaf) {
+        return;
+    }
+    Inner* inner = static_cast<Inner*>(node);
+    for (int i = 0; i < inner->count; ++i) {
+        const char* id = separators.data() + inner->id[i];
+        inner->id[i] = static_cast<uint32_t>(compacted.size());
+        compacted.insert(compacted.end(), id, id + inner->length[i]);
+    }
+    for (int i = 0; i <= inner->count; ++i) {
+        compactSeparators(inner->child[i], compacted);
+    }
+}
+
+/**
+ * Renumber the value slots in key order so an in-order scan reads the
+ * bids sequentially, and drop the separator ids that removes left
+ * behind. Worth calling once after a bulk load.
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void BPlusTree::Compact() {
+    vector<Bid> ordered;
+    ordered.reserve(size);
+    for (Leaf* leaf = head; leaf != nullptr; leaf = leaf->next) {
+        for (int i = 0; i < leaf->count; ++i) {
+            ordered.push_back(move(values[leaf->slot[i]]));
+            leaf->slot[i] = static_cast<uint32_t>(ordered.size() - 1);
+        }
+    }
+    values.swap(ordered);
+    freeSlots.clear();
+
+    vector<char> compacted;
+    compactSeparators(root, compacted);
+    separators.swap(compacted);
+}
+
+/**
+ * Number of bids stored
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+size_t BPlusTree::Size() {
+    return size;
+}
+
+/**
+ * Number of levels, 0 when empty
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+int BPlusTree::Height() {
+    int levels = 0;
+    for (Node* node = root; node != nullptr; ++levels) {
+        node = node->leaf ? nullptr : static_cast<Inner*>(node)->child[0];
+    }
+    return levels;
+}
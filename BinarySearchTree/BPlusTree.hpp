@@ -0,0 +1,118 @@
+//============================================================================
+// Name        : BPlusTree.hpp
+// Author      : Dylan Harmon
+// Version     : 1.0
+// Description : In-memory B+ tree of bids keyed on bidId
+//============================================================================
+
+#ifndef BPLUSTREE_HPP_
+#define BPLUSTREE_HPP_
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Bid.hpp"
+
+//============================================================================
+// B+ Tree class definition
+//============================================================================
+
+/**
+ * Ordered bid storage with wide nodes.
+ *
+ * Every node keeps up to ORDER fixed-width BidKey prefixes in one
+ * contiguous array, so a lookup scans a couple of cache lines per level
+ * instead of chasing one pointer and one std::string per level like
+ * BinarySearchTree. The bids themselves live out of line in a slot
+ * vector; leaves hold only slot indices and are linked both ways for
+ * in-order scans. Inner nodes hold their separator ids as offsets into
+ * one shared character arena, which Compact rebuilds.
+ *
+ * Nodes are split top-down on insert. On remove a node is freed once it
+ * is empty rather than merged with a sibling, which keeps deletes cheap
+ * at the cost of some underfull nodes after heavy churn.
+ *
+ * Duplicate ids are allowed and kept in insertion order, like the BST.
+ */
+class BPlusTree {
+
+private:
+    // keys per node; the 16 prefixes alone fill two cache lines, and with
+    // the header and lengths a leaf is 280 bytes and an inner node 400
+    static const int ORDER = 16;
+
+    struct Node {
+        bool leaf;
+        int count;                // keys in use
+        uint64_t prefix[ORDER];   // BidKey::prefix of each key
+        uint32_t length[ORDER];   // BidKey::length of each key
+    };
+
+    struct Leaf : Node {
+        uint32_t slot[ORDER];     // index of each bid in values
+        Leaf* prev;
+        Leaf* next;
+    };
+
+    // key i separates child i (keys <= it) from child i + 1 (keys >= it)
+    struct Inner : Node {
+        Node* child[ORDER + 1];
+        uint32_t id[ORDER];       // offset of each separator id in separators, read only on a prefix tie
+    };
+
+    // one step of a root-to-leaf path
+    struct Step {
+        Inner* node;
+        int index;
+    };
+
+    Node* root;
+    Leaf* head;                   // leftmost leaf
+    Leaf* tail;                   // rightmost leaf
+    size_t size;
+
+    std::vector<Bid> values;      // bids stored out of line
+    std::vector<uint32_t> freeSlots;
+    std::vector<char> separators; // inner separator ids back to back; dropped ones stay until Compact
+
+    std::string_view keyId(const Node* node, int i) const;
+    uint32_t addSeparator(const std::string& id);
+    void compactSeparators(Node* node, std::vector<char>& compacted);
+    int compareAt(const Node* node, int i, const BidKey& key, const std::string& id) const;
+    int lowerBound(const Node* node, const BidKey& key, const std::string& id) const;
+    int upperBound(const Node* node, const BidKey& key, const std::string& id) const;
+
+    Leaf* findLeaf(const BidKey& key, const std::string& id, std::vector<Step>* path, int& pos) const;
+    void splitChild(Inner* parent, int i);
+    void removeChild(std::vector<Step>& path);
+    void destroy(Node* node);
+
+public:
+    BPlusTree();
+    virtual ~BPlusTree();
+    void InOrder();
+    void Insert(Bid bid);
+    void Remove(std::string bidId);
+    Bid Search(std::string bidId);
+    void Compact();
+    size_t Size();
+    int Height();
+
+    /**
+     * Visit every bid in bidId order by walking the linked leaves
+     *
+     * @param visit callable taking const Bid&
+     */
+    template <typename Visitor>
+    void ForEach(Visitor visit) const {
+        for (const Leaf* leaf = head; leaf != nullptr; leaf = leaf->next) {
+            for (int i = 0; i < leaf->count; ++i) {
+                visit(values[leaf->slot[i]]);
+            }
+        }
+    }
+};
+
+#endif /* BPLUSTREE_HPP_ */
@@ -0,0 +1,74 @@
+//============================================================================
+// Name        : Bid.hpp
+// Author      : Dylan Harmon
+// Version     : 1.0
+// Description : Bid record and fixed-width bid id keys shared by the
+//               ordered bid engines
+//============================================================================
+
+#ifndef BID_HPP_
+#define BID_HPP_
+
+#include <cstdint>
+#include <string>
+
+// define a structure to hold bid information
+struct Bid {
+    std::string bidId; // unique identifier
+    std::string title;
+    std::string fund;
+    double amount;
+    Bid() {
+        amount = 0.0;
+    }
+};
+
+/**
+ * Fixed-width, order-preserving key for a bid id.
+ *
+ * The first 8 bytes of the id are packed big-endian (zero padded) so
+ * comparing two prefixes as integers gives the same answer as comparing
+ * the strings, except when the prefixes tie. For ids of up to 8 bytes
+ * the prefix plus the length is the whole id, so a tie is settled
+ * without touching the heap string at all.
+ */
+struct BidKey {
+    uint64_t prefix;
+    uint32_t length;
+
+    BidKey() : prefix(0), length(0) {
+    }
+
+    explicit BidKey(const std::string& id) : prefix(0), length(static_cast<uint32_t>(id.size())) {
+        for (size_t i = 0; i < 8; ++i) {
+            prefix <<= 8;
+            if (i < id.size()) {
+                prefix |= static_cast<unsigned char>(id[i]);
+            }
+        }
+    }
+
+    // true when prefix and length fully describe the id
+    bool exact() const {
+        return length <= 8;
+    }
+};
+
+/**
+ * Three-way compare two bid ids through their keys, falling back to the
+ * full strings only when the prefixes tie on long ids.
+ *
+ * @return <0, 0 or >0 like std::string::compare
+ */
+inline int compareBidIds(const BidKey& a, const std::string& aId,
+                         const BidKey& b, const std::string& bId) {
+    if (a.prefix != b.prefix) {
+        return a.prefix < b.prefix ? -1 : 1;
+    }
+    if (a.exact() && b.exact()) {
+        return a.length == b.length ? 0 : (a.length < b.length ? -1 : 1);
+    }
+    return aId.compare(bId);
+}
+
+#endif /* BID_HPP_ */
@@ -1,500 +1,1874 @@
-//============================================================================
-// Name        : BinarySearchTree.cpp
-// Author      : Dylan Harmon
-// Version     : 1.0
-// Copyright   : Copyright � 2023 SNHU COCE
-// Description : Lab 5-2 Binary Search Tree
-//============================================================================
-
-#include <iostream>
-#include <time.h>
-
-#include "CSVparser.hpp"
-
-using namespace std;
-
-//============================================================================
-// Global definitions visible to all methods and classes
-//============================================================================
-
-// forward declarations
-double strToDouble(string str, char ch);
-
-// define a structure to hold bid information
-struct Bid {
-    string bidId; // unique identifier
-    string title;
-    string fund;
-    double amount;
-    Bid() {
-        amount = 0.0;
-    }
-};
-
-// Internal structure for tree node
-struct Node {
-    Bid bid;
-    Node *left;
-    Node *right;
-
-    // default constructor
-    Node() {
-        left = nullptr;
-        right = nullptr;
-    }
-
-    // initialize with a bid
-    Node(Bid aBid) :
-            Node() {
-        bid = aBid;
-    }
-};
-
-//============================================================================
-// Binary Search Tree class definition
-//============================================================================
-
-/**
- * Define a class containing data members and methods to
- * implement a binary search tree
- */
-class BinarySearchTree {
-
-private:
-    Node* root;
-
-    void addNode(Node* node, Bid bid);
-    void inOrder(Node* node);
-    void postOrder(Node* node);
-    void preOrder(Node* node);
-    Node* removeNode(Node* node, string bidId);
-
-public:
-    BinarySearchTree();
-    virtual ~BinarySearchTree();
-    void InOrder();
-    void PostOrder();
-    void PreOrder();
-    void Insert(Bid bid);
-    void Remove(string bidId);
-    Bid Search(string bidId);
-};
-
-/**
- * Default constructor
- * Author: Dylan Harmon
- * Date: 7/29/2025
- */
-BinarySearchTree::BinarySearchTree() {
-
-	root = nullptr; // initialize root to null pointer
-}
-
-/**
- * Destructor
- * Author: Dylan Harmon
- * Date: 7/29/2025
- */
-BinarySearchTree::~BinarySearchTree() {
-
-    while (root != nullptr) {
-
-        // remove all nodes from the tree
-        removeNode(root, root->bid.bidId);
-	}
-}
-
-/**
- * Traverse the tree in order
- * Author: Dylan Harmon
- * Date: 7/29/2025
- */
-void BinarySearchTree::InOrder() {
-   
-    // call inOrder fuction and pass root
-	this->inOrder(root);
-}
-
-/**
- * Traverse the tree in post-order
- * Author: Dylan Harmon
- * Date: 7/29/2025
- */
-void BinarySearchTree::PostOrder() {
-    
-    // postOrder root
-	this->postOrder(root);
-}
-
-/**
- * Traverse the tree in pre-order
- * Author: Dylan Harmon
- * Date: 7/29/2025
- */
-void BinarySearchTree::PreOrder() {
-    
-    // preOrder root
-	this->preOrder(root);
-}
-
-
-
-/**
- * Insert a bid
- * Author: Dylan Harmon
- * Date: 7/28/2025
- */
-void BinarySearchTree::Insert(Bid bid) {
-    
-    
-    if (root == nullptr) {
-		root = new Node(bid); // if root is null, create a new node
-     
-    }
-    else {
-		addNode(root, bid);
-    }
-}
-
-/**
- * Remove a bid
- * Author: Dylan Harmon
- * Date: 7/28/2025
- */
-void BinarySearchTree::Remove(string bidId) {
-    
-	this->removeNode(root, bidId); // call removeNode with root and bidId
-}
-
-/**
- * Search for a bid
- * Author: Dylan Harmon
- * Date: 7/28/2025
- */
-Bid BinarySearchTree::Search(string bidId) {
-    
-	Node* current = root; // start at root
-
-	/* while current node is not equal to null
-        if current node bidId matches bidId return current node bid
-        else if bidId is smaller than current node bidId then traverse left
-		else traverse right
-    */
-    while (current != nullptr) {
-        if (current->bid.bidId.compare(bidId) == 0) {
-            return current->bid;
-        }
-        else if (bidId.compare(current->bid.bidId) < 0) {
-            current = current->left; // traverse left
-        } else {
-            current = current->right; // traverse right
-		}
-    }
-	// if no match found return empty bid
-	std::cout << "Bid ID " << bidId << " not found." << endl;
-
-
-    Bid bid;
-    return bid;
-}
-
-/**
- * Add a bid to some node (recursive)
- *
- * @param node Current node in tree
- * @param bid Bid to be added
- * 
- * Author: Dylan Harmon
- * Date: 7/28/2025
- */
-void BinarySearchTree::addNode(Node* node, Bid bid) {
-    
-        if (node->bid.bidId.compare(bid.bidId) > 0) {
-            if (node->left == nullptr){ //if no left node
-				node->left = new Node(bid); // this node becomes left child node
-			}
-			else { // recurse down the left node
-				this->addNode(node->left, bid);
-            }
-		}
-        else { // add to right subtree
-			if (node->right == nullptr) { // if no right node
-				node->right = new Node(bid); // this node becomes right child node
-
-			}
-			else { // recurse down the right node
-				this->addNode(node->right, bid);
-            }
-
-        }
-}
-/*
-* Traverse the tree in order
-* @param node Current node in tree
-* 
-* Author: Dylan Harmon
-* Date: 7/29/2025
-*/
-void BinarySearchTree::inOrder(Node* node) {
-
-    if (node != nullptr) {
-        inOrder(node->left);
-
-        std::cout << node->bid.bidId << ": " 
-            << node->bid.title << " | " 
-            << node->bid.amount << " | "
-            << node->bid.fund << endl;
-
-        inOrder(node->right);
-        }
-}
-/**
- * Traverse the tree in post-order
- * @param node Current node in tree
- * 
- * Author: Dylan Harmon
- * Date: 7/29/2025
- */
-void BinarySearchTree::postOrder(Node* node) {
-     
-    if (node != nullptr) {
-        postOrder(node->left);
-        postOrder(node->right);
-        std::cout << node->bid.bidId << ": "
-            << node->bid.title << " | "
-            << node->bid.amount << " | "
-            << node->bid.fund << endl;
-    }
-}
-/*
-*
-* Traverse the tree in pre-order
-* @param node Current node in tree
-* Author: Dylan Harmon
-* Date: 7/29/2025
-* 
-*/
-void BinarySearchTree::preOrder(Node * node) {
-
-    if (node != nullptr) {
-        std::cout << node->bid.bidId << ": "
-                    << node->bid.title << " | "
-                    << node->bid.amount << " | " 
-                    << node->bid.fund << endl;
-
-            preOrder(node->left);
-            preOrder(node->right);
-        }
- }
-
-/**
- * Remove a bid from some node (recursive)
- * 
- * Author: Dylan Harmon
- * Date: 7/29/2025
- */
-Node* BinarySearchTree::removeNode(Node* node, string bidId) {
-    // FIXME (7b) Implement removing a bid from the tree
-    // if this node is null then return
-    if (node == nullptr) {
-		return node; // return null pointer
-    }
-
-	//recurse down the left subtree
-    if (bidId.compare(node->bid.bidId) < 0) {
-		node->left = removeNode(node->left, bidId); // check left node
-    }
-    else if (bidId.compare(node->bid.bidId) > 0) { // recurse down the right subtree
-		node->right = removeNode(node->right, bidId); // check right node
-    }
-    else {
-        // leaf node (no children)
-        if (node->left == nullptr && node->right == nullptr) {
-            delete node; // delete node
-            node = nullptr;
-		}
-        // one child (left)
-        else if (node->left != nullptr && node->right == nullptr) {
-			Node* temp = node; // create a temp node
-            node = node->left;
-			delete temp; // delete temp node
-        }
-        // one child (right)
-        else if (node->left == nullptr && node->right != nullptr) {
-            Node* temp = node; // create a temp node
-            node = node->right;
-            delete temp; // delete temp node
-        }
-        // two children
-        else {
-            Node* temp = node->right; // create a temp node to right
-            while (temp->left != nullptr) { // while left node is not null
-                temp = temp->left; // keep moving left
-            }
-            node->bid = temp->bid; // make node bid equal to temp bid
-            node->right = removeNode(node->right, temp->bid.bidId); // remove right node using recursive call
-		}
-    }
-    return node;
-}
-
-
-
-//============================================================================
-// Static methods used for testing
-//============================================================================
-
-/**
- * Display the bid information to the console (std::out)
- *
- * @param bid struct containing the bid info
- */
-void displayBid(Bid bid) {
-    cout << bid.bidId << ": " << bid.title << " | " << bid.amount << " | "
-            << bid.fund << endl;
-    return;
-}
-
-/**
- * Load a CSV file containing bids into a container
- *
- * @param csvPath the path to the CSV file to load
- * @return a container holding all the bids read
- */
-void loadBids(string csvPath, BinarySearchTree* bst) {
-    cout << "Loading CSV file " << csvPath << endl;
-
-    // initialize the CSV Parser using the given path
-    csv::Parser file = csv::Parser(csvPath);
-
-    // read and display header row - optional
-    vector<string> header = file.getHeader();
-    for (auto const& c : header) {
-        cout << c << " | ";
-    }
-    cout << "" << endl;
-
-    try {
-        // loop to read rows of a CSV file
-        for (unsigned int i = 0; i < file.rowCount(); i++) {
-
-            // Create a data structure and add to the collection of bids
-            Bid bid;
-            bid.bidId = file[i][1];
-            bid.title = file[i][0];
-            bid.fund = file[i][8];
-            bid.amount = strToDouble(file[i][4], '$');
-
-            //cout << "Item: " << bid.title << ", Fund: " << bid.fund << ", Amount: " << bid.amount << endl;
-
-            // push this bid to the end
-            bst->Insert(bid);
-        }
-    } catch (csv::Error &e) {
-        std::cerr << e.what() << std::endl;
-    }
-}
-
-/**
- * Simple C function to convert a string to a double
- * after stripping out unwanted char
- *
- * credit: http://stackoverflow.com/a/24875936
- *
- * @param ch The character to strip out
- */
-double strToDouble(string str, char ch) {
-    str.erase(remove(str.begin(), str.end(), ch), str.end());
-    return atof(str.c_str());
-}
-
-/**
- * The one and only main() method
- */
-int main(int argc, char* argv[]) {
-
-    // process command line arguments
-    string csvPath, bidKey;
-    switch (argc) {
-    case 2:
-        csvPath = argv[1];
-        bidKey = "98223";
-        break;
-    case 3:
-        csvPath = argv[1];
-        bidKey = argv[2];
-        break;
-    default:
-        csvPath = "eBid_Monthly_Sales.csv";
-        bidKey = "98223";
-    }
-
-    // Define a timer variable
-    clock_t ticks;
-
-    // Define a binary search tree to hold all bids
-    BinarySearchTree* bst;
-    bst = new BinarySearchTree();
-    Bid bid;
-
-    int choice = 0;
-    while (choice != 9) {
-        cout << "Menu:" << endl;
-        cout << "  1. Load Bids" << endl;
-        cout << "  2. Display All Bids" << endl;
-        cout << "  3. Find Bid" << endl;
-        cout << "  4. Remove Bid" << endl;
-        cout << "  9. Exit" << endl;
-        cout << "Enter choice: ";
-        cin >> choice;
-
-        switch (choice) {
-
-        case 1:
-            
-            // Initialize a timer variable before loading bids
-            ticks = clock();
-
-            // Complete the method call to load the bids
-            loadBids(csvPath, bst);
-
-            //cout << bst->Size() << " bids read" << endl;
-
-            // Calculate elapsed time and display result
-            ticks = clock() - ticks; // current clock ticks minus starting clock ticks
-            cout << "time: " << ticks << " clock ticks" << endl;
-            cout << "time: " << ticks * 1.0 / CLOCKS_PER_SEC << " seconds" << endl;
-            break;
-
-        case 2:
-            bst->InOrder();
-            break;
-
-        case 3:
-            ticks = clock();
-
-            bid = bst->Search(bidKey);
-
-            ticks = clock() - ticks; // current clock ticks minus starting clock ticks
-
-            if (!bid.bidId.empty()) {
-                displayBid(bid);
-            } else {
-            	cout << "Bid Id " << bidKey << " not found." << endl;
-            }
-
-            cout << "time: " << ticks << " clock ticks" << endl;
-            cout << "time: " << ticks * 1.0 / CLOCKS_PER_SEC << " seconds" << endl;
-
-            break;
-
-        case 4:
-            bst->Remove(bidKey);
-            break;
-        }
-    }
-
-    cout << "Good bye." << endl;
-
-	return 0;
-}
+//============================================================================
+// Name        : BinarySearchTree.cpp
+// Author      : Dylan Harmon
+// Version     : 1.0
+// Copyright   : Copyright � 2023 SNHU COCE
+// Description : Lab 5-2 Binary Search Tree
+//============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <cmath>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <thread>
+#include <time.h>
+#include <vector>
+
+// parallel sort for BulkLoad when the standard library provides it
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#include <execution>
+#endif
+
+#include "AdaptiveRadixTree.hpp"
+#include "BPlusTree.hpp"
+#include "Bid.hpp"
+#include "CSVparser.hpp"
+#include "EytzingerIndex.hpp"
+#include "SnapshotTree.hpp"
+#include "../Common/HashTable.hpp"
+#include "../Common/OrderedMap.hpp"
+#include "../Common/ThreadPool.hpp"
+
+using namespace std;
+
+//============================================================================
+// Global definitions visible to all methods and classes
+//============================================================================
+
+// forward declarations
+double strToDouble(string str, char ch);
+
+// Summary of Bid.amount over a set of bids
+struct BidAggregate {
+    size_t count;
+    double sum;
+    double min;
+    double max;
+
+    // empty set
+    BidAggregate() {
+        count = 0;
+        sum = 0.0;
+        min = DBL_MAX;
+        max = -DBL_MAX;
+    }
+
+    // fold in a subtree summary
+    void add(size_t aCount, double aSum, double aMin, double aMax) {
+        count += aCount;
+        sum += aSum;
+        min = std::min(min, aMin);
+        max = std::max(max, aMax);
+    }
+};
+
+// Index of a node in the tree's pool; 0 is the empty subtree
+typedef uint32_t NodeIndex;
+const NodeIndex NIL = 0;
+
+// Internal structure for tree node
+//
+// Nodes live in one contiguous pool and name their children by 32-bit
+// index. The bid for node i is stored out of line at bids[i]; the node
+// keeps a BidKey copy of its id so a walk down the tree compares integer
+// prefixes and only reads the bid's string when two prefixes tie.
+struct Node {
+    BidKey key;       // order-preserving prefix of bids[i].bidId
+    NodeIndex left;
+    NodeIndex right;
+    uint32_t size;    // number of nodes in the subtree rooted here
+    int32_t height;   // height of the subtree rooted here, leaf = 1
+    double amount;    // this node's bid amount, kept in the pool for update()
+    double amountSum; // sum, min and max of amount over the subtree
+    double amountMin;
+    double amountMax;
+
+    // default constructor builds the empty-subtree sentinel
+    Node() {
+        left = NIL;
+        right = NIL;
+        size = 0;
+        height = 0;
+        amount = 0.0;
+        amountSum = 0.0;
+        amountMin = DBL_MAX;
+        amountMax = -DBL_MAX;
+    }
+
+    // initialize a leaf for a bid
+    explicit Node(const Bid& bid) :
+            Node() {
+        key = BidKey(bid.bidId);
+        size = 1;
+        height = 1;
+        amount = amountSum = amountMin = amountMax = bid.amount;
+    }
+};
+
+// How the tree keeps itself in shape as bids are added and removed
+enum class TreeMode {
+    Unbalanced, // plain BST, shape depends on insertion order
+    AVL,        // height-balanced, O(log n) height guaranteed
+    Splay       // self-adjusting, each search or insert moves its bid to the root;
+                // Search then restructures the tree and counts as a modification
+};
+
+//============================================================================
+// Binary Search Tree class definition
+//============================================================================
+
+/**
+ * Define a class containing data members and methods to
+ * implement a binary search tree
+ */
+class BinarySearchTree {
+
+private:
+    NodeIndex root;
+    TreeMode mode;
+    EytzingerIndex frozen; // read-only copy for lookup-heavy phases
+    bool frozenStale;      // set by every write, cleared by Freeze()
+
+    // node pool; nodes[0] and bids[0] are the NIL sentinel
+    static const size_t PARALLEL_SORT_MIN = 100000;
+    static const size_t SPLAY_DEPTH = 2;     // splay searches that went deeper than this
+    static const size_t PARALLEL_GRAIN = 4096; // largest subtree walked by one task
+    vector<Node> nodes;
+    vector<Bid> bids;
+    vector<NodeIndex> freeNodes;
+    vector<NodeIndex*> accessPath; // reused by splay-mode searches
+
+    NodeIndex newNode(Bid bid);
+    void freeNode(NodeIndex node);
+    NodeIndex build(NodeIndex begin, NodeIndex end);
+
+    void addNode(Bid bid);
+    void inOrder(NodeIndex node);
+    void postOrder(NodeIndex node);
+    void preOrder(NodeIndex node);
+    void removeNode(string bidId);
+    int compareKey(NodeIndex node, const BidKey& key, const string& bidId) const;
+
+    void addSubtree(BidAggregate& total, NodeIndex node);
+    void update(NodeIndex node);
+    NodeIndex rotateLeft(NodeIndex node);
+    NodeIndex rotateRight(NodeIndex node);
+    NodeIndex rebalance(NodeIndex node);
+    void retrace(vector<NodeIndex*>& path);
+    void splay(vector<NodeIndex*>& path);
+    vector<Bid> collect();
+
+    // a unit of parallel work: a whole subtree, or one node between subtrees
+    struct Chunk {
+        NodeIndex node;
+        size_t offset; // in-order position of the first bid covered
+        bool whole;
+    };
+    vector<Chunk> split();
+    template <typename Visitor>
+    void walk(NodeIndex node, Visitor& visit);
+
+public:
+    /**
+     * Lazy bidirectional iterator over the bids in bidId order.
+     *
+     * Holds the path from the root to the current node, so stepping is
+     * amortized O(1) without parent pointers. An empty path is end().
+     * Any Insert or Remove invalidates existing iterators, and so does
+     * Search in Splay mode, since it rotates the tree.
+     */
+    class Iterator {
+    public:
+        typedef bidirectional_iterator_tag iterator_category;
+        typedef Bid value_type;
+        typedef ptrdiff_t difference_type;
+        typedef const Bid* pointer;
+        typedef const Bid& reference;
+
+        Iterator() : tree(nullptr) {}
+
+        reference operator*() const { return tree->bids[path.back()]; }
+        pointer operator->() const { return &tree->bids[path.back()]; }
+        Iterator& operator++();
+        Iterator& operator--();
+        Iterator operator++(int) { Iterator old = *this; ++*this; return old; }
+        Iterator operator--(int) { Iterator old = *this; --*this; return old; }
+        bool operator==(const Iterator& other) const {
+            return (path.empty() ? NIL : path.back()) == (other.path.empty() ? NIL : other.path.back());
+        }
+        bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+    private:
+        friend class BinarySearchTree;
+        const BinarySearchTree* tree;
+        vector<NodeIndex> path;
+
+        void descend(NodeIndex node, bool leftmost);
+    };
+
+    BinarySearchTree(TreeMode mode = TreeMode::AVL);
+    virtual ~BinarySearchTree();
+    void InOrder();
+    void PostOrder();
+    void PreOrder();
+    void Insert(Bid bid);
+    void BulkLoad(vector<Bid>&& bids);
+    void Remove(string bidId);
+    void Clear();
+    Bid Search(string bidId);
+    int Height();
+    size_t Size();
+    size_t Rank(string bidId);
+    Bid Select(size_t k);
+    Iterator Nth(size_t k);
+    BidAggregate Aggregate();
+    BidAggregate RangeAggregate(string lo, string hi);
+    void Freeze();
+    Bid FrozenSearch(string bidId);
+    Iterator begin();
+    Iterator end();
+    Iterator LowerBound(string bidId);
+    Iterator UpperBound(string bidId);
+    template <typename Visitor>
+    size_t RangeScan(string lo, string hi, Visitor visit);
+    template <typename Visitor>
+    void ParallelForEach(ThreadPool& pool, Visitor visit);
+    template <typename T, typename Fold, typename Combine>
+    T ParallelReduce(ThreadPool& pool, T identity, Fold fold, Combine combine);
+    vector<Bid> ParallelExport(ThreadPool& pool);
+};
+
+/**
+ * Default constructor
+ * Author: Dylan Harmon
+ * Date: 7/29/2025
+ */
+BinarySearchTree::BinarySearchTree(TreeMode mode) {
+
+	root = NIL; // initialize root to the empty subtree
+    this->mode = mode;
+    frozenStale = true;
+
+    // slot 0 is the sentinel every missing child points at
+    nodes.push_back(Node());
+    bids.push_back(Bid());
+}
+
+/**
+ * Destructor
+ * Author: Dylan Harmon
+ * Date: 7/29/2025
+ */
+BinarySearchTree::~BinarySearchTree() {
+
+    // the pool vectors own every node, so nothing needs walking
+}
+
+/**
+ * Traverse the tree in order
+ * Author: Dylan Harmon
+ * Date: 7/29/2025
+ */
+void BinarySearchTree::InOrder() {
+   
+    // call inOrder fuction and pass root
+	this->inOrder(root);
+}
+
+/**
+ * Traverse the tree in post-order
+ * Author: Dylan Harmon
+ * Date: 7/29/2025
+ */
+void BinarySearchTree::PostOrder() {
+    
+    // postOrder root
+	this->postOrder(root);
+}
+
+/**
+ * Traverse the tree in pre-order
+ * Author: Dylan Harmon
+ * Date: 7/29/2025
+ */
+void BinarySearchTree::PreOrder() {
+    
+    // preOrder root
+	this->preOrder(root);
+}
+
+
+
+/**
+ * Insert a bid
+ * Author: Dylan Harmon
+ * Date: 7/28/2025
+ */
+void BinarySearchTree::Insert(Bid bid) {
+    
+    frozenStale = true;
+    if (root == NIL) {
+		root = newNode(bid); // if root is empty, create a new node
+     
+    }
+    else {
+		addNode(bid);
+    }
+}
+
+/**
+ * Load many bids at once
+ *
+ * Sorts once (in parallel where the standard library supports it, and
+ * not at all if the input is already in order), merges with anything
+ * already in the tree, then builds a perfectly balanced tree bottom-up
+ * in O(n) over a freshly packed pool laid out in key order.
+ * Ties keep their input order, like repeated Insert calls.
+ *
+ * @param bids bids to add; the vector is consumed
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void BinarySearchTree::BulkLoad(vector<Bid>&& bids) {
+    auto byId = [](const Bid& a, const Bid& b) {
+        return a.bidId.compare(b.bidId) < 0;
+    };
+
+    if (!is_sorted(bids.begin(), bids.end(), byId)) {
+#if defined(__cpp_lib_parallel_algorithm)
+        // below this size starting the worker threads costs more than it saves
+        if (bids.size() >= PARALLEL_SORT_MIN) {
+            stable_sort(execution::par, bids.begin(), bids.end(), byId);
+        }
+        else
+#endif
+        {
+            stable_sort(bids.begin(), bids.end(), byId);
+        }
+    }
+
+    // fold in the current contents, which come out already sorted
+    if (root != NIL) {
+        vector<Bid> current = collect();
+        vector<Bid> merged;
+        merged.reserve(current.size() + bids.size());
+        merge(make_move_iterator(current.begin()), make_move_iterator(current.end()),
+            make_move_iterator(bids.begin()), make_move_iterator(bids.end()),
+            back_inserter(merged), byId);
+        bids.swap(merged);
+    }
+
+    // repack the pool so node i + 1 holds the i-th smallest bid
+    Clear();
+    nodes.reserve(bids.size() + 1);
+    this->bids.reserve(bids.size() + 1);
+    for (Bid& bid : bids) {
+        nodes.push_back(Node(bid));
+        this->bids.push_back(move(bid));
+    }
+    bids.clear();
+
+    root = build(1, static_cast<NodeIndex>(nodes.size()));
+    frozenStale = true;
+}
+
+/**
+ * Link pool nodes [begin, end), already in key order, into a perfectly
+ * balanced subtree
+ *
+ * @return the subtree root
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+NodeIndex BinarySearchTree::build(NodeIndex begin, NodeIndex end) {
+    if (begin >= end) {
+        return NIL;
+    }
+    NodeIndex mid = begin + (end - begin) / 2;
+    nodes[mid].left = build(begin, mid);
+    nodes[mid].right = build(mid + 1, end);
+    update(mid);
+    return mid;
+}
+
+/**
+ * Remove a bid
+ * Author: Dylan Harmon
+ * Date: 7/28/2025
+ */
+void BinarySearchTree::Remove(string bidId) {
+    
+    frozenStale = true;
+	this->removeNode(bidId); // call removeNode with bidId
+}
+
+/**
+ * Remove every bid. The pool keeps only its sentinel, so this releases
+ * all nodes at once instead of unlinking them one by one.
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void BinarySearchTree::Clear() {
+    root = NIL;
+    nodes.resize(1);
+    bids.resize(1);
+    freeNodes.clear();
+    frozenStale = true;
+}
+
+/**
+ * Search for a bid
+ *
+ * In Splay mode this may rotate the found bid (or the last node tried)
+ * toward the root, so it counts as a modification: it invalidates
+ * iterators and must not run during RangeScan or a parallel visit.
+ *
+ * Author: Dylan Harmon
+ * Date: 7/28/2025
+ */
+Bid BinarySearchTree::Search(string bidId) {
+    
+	NodeIndex current = root; // start at root
+    const BidKey key(bidId);
+
+    // splay mode: bring the match, or the last node tried, up to the root
+    if (mode == TreeMode::Splay) {
+        NodeIndex found = NIL;
+        accessPath.clear();
+        for (NodeIndex* link = &root; *link != NIL;) {
+            accessPath.push_back(link);
+            int order = compareKey(*link, key, bidId);
+            if (order == 0) {
+                found = *link;
+                break;
+            }
+            link = order > 0 ? &nodes[*link].left : &nodes[*link].right;
+        }
+        // bids already near the root stay put; rotating them costs more than it saves
+        if (accessPath.size() > SPLAY_DEPTH) {
+            splay(accessPath);
+        }
+        current = found; // a node keeps its index when rotated
+    }
+
+	/* while current node is not empty
+        if current node bidId matches bidId return current node bid
+        else if bidId is smaller than current node bidId then traverse left
+		else traverse right
+    */
+    while (current != NIL) {
+        int order = compareKey(current, key, bidId);
+        if (order == 0) {
+            return bids[current];
+        }
+        else if (order > 0) {
+            current = nodes[current].left; // traverse left
+        } else {
+            current = nodes[current].right; // traverse right
+		}
+    }
+	// if no match found return empty bid
+	std::cout << "Bid ID " << bidId << " not found." << endl;
+
+
+    Bid bid;
+    return bid;
+}
+
+/**
+ * Height of the tree, 0 when empty
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+int BinarySearchTree::Height() {
+    return nodes[root].height;
+}
+
+/**
+ * Number of bids in the tree
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+size_t BinarySearchTree::Size() {
+    return nodes[root].size;
+}
+
+/**
+ * Number of bids whose id is less than bidId, in O(log n)
+ *
+ * @param bidId id to rank; it does not have to be in the tree
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+size_t BinarySearchTree::Rank(string bidId) {
+    size_t rank = 0;
+    const BidKey key(bidId);
+    NodeIndex node = root;
+    while (node != NIL) {
+        if (compareKey(node, key, bidId) < 0) {
+            // node and its whole left subtree come before bidId
+            rank += nodes[nodes[node].left].size + 1;
+            node = nodes[node].right;
+        }
+        else {
+            node = nodes[node].left;
+        }
+    }
+    return rank;
+}
+
+/**
+ * The k-th smallest bid (0-based), in O(log n)
+ *
+ * @return the bid, or an empty bid when k >= Size()
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+Bid BinarySearchTree::Select(size_t k) {
+    Iterator it = Nth(k);
+    return it != end() ? *it : Bid();
+}
+
+/**
+ * Iterator at the k-th smallest bid (0-based), or end(), in O(log n).
+ * Use it to start a page of results without scanning from the start.
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+BinarySearchTree::Iterator BinarySearchTree::Nth(size_t k) {
+    Iterator it;
+    it.tree = this;
+    if (k >= nodes[root].size) {
+        return it;
+    }
+    NodeIndex node = root;
+    while (node != NIL) {
+        it.path.push_back(node);
+        size_t leftSize = nodes[nodes[node].left].size;
+        if (k < leftSize) {
+            node = nodes[node].left;
+        }
+        else if (k == leftSize) {
+            break;
+        }
+        else {
+            k -= leftSize + 1;
+            node = nodes[node].right;
+        }
+    }
+    return it;
+}
+
+/**
+ * Count, sum, min and max of every bid amount, in O(1)
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+BidAggregate BinarySearchTree::Aggregate() {
+    BidAggregate total;
+    addSubtree(total, root);
+    return total;
+}
+
+/**
+ * Count, sum, min and max of the amounts of bids with lo <= bidId <= hi.
+ *
+ * Walks the two boundary paths below the node where lo and hi split,
+ * folding in the cached totals of whole subtrees that fall inside the
+ * range, so no individual bid outside those paths is visited: O(log n).
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+BidAggregate BinarySearchTree::RangeAggregate(string lo, string hi) {
+    BidAggregate total;
+    const BidKey loKey(lo);
+    const BidKey hiKey(hi);
+
+    // find the highest node inside the range
+    NodeIndex split = root;
+    while (split != NIL) {
+        if (compareKey(split, loKey, lo) < 0) {
+            split = nodes[split].right;
+        }
+        else if (compareKey(split, hiKey, hi) > 0) {
+            split = nodes[split].left;
+        }
+        else {
+            break;
+        }
+    }
+    if (split == NIL) {
+        return total;
+    }
+    double amount = nodes[split].amount;
+    total.add(1, amount, amount, amount);
+
+    // left boundary: everything right of a node >= lo is inside
+    for (NodeIndex node = nodes[split].left; node != NIL;) {
+        if (compareKey(node, loKey, lo) >= 0) {
+            amount = nodes[node].amount;
+            total.add(1, amount, amount, amount);
+            addSubtree(total, nodes[node].right);
+            node = nodes[node].left;
+        }
+        else {
+            node = nodes[node].right;
+        }
+    }
+
+    // right boundary: everything left of a node <= hi is inside
+    for (NodeIndex node = nodes[split].right; node != NIL;) {
+        if (compareKey(node, hiKey, hi) <= 0) {
+            amount = nodes[node].amount;
+            total.add(1, amount, amount, amount);
+            addSubtree(total, nodes[node].left);
+            node = nodes[node].right;
+        }
+        else {
+            node = nodes[node].left;
+        }
+    }
+    return total;
+}
+
+/**
+ * Rebuild the frozen Eytzinger index from the current contents
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void BinarySearchTree::Freeze() {
+    frozen.Build(collect());
+    frozenStale = false;
+}
+
+/**
+ * Search for a bid through the frozen index, rebuilding it first if
+ * the tree changed since the last Freeze()
+ *
+ * @return the matching bid, or an empty bid if not found
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+Bid BinarySearchTree::FrozenSearch(string bidId) {
+    if (frozenStale) {
+        Freeze();
+    }
+    return frozen.Search(bidId);
+}
+
+/**
+ * Add a bid to the tree
+ *
+ * Walks down iteratively, recording the links it follows, so a
+ * degenerate tree cannot overflow the call stack. In AVL mode the
+ * recorded path is then retraced to restore balance.
+ *
+ * @param bid Bid to be added
+ * 
+ * Author: Dylan Harmon
+ * Date: 7/28/2025
+ */
+void BinarySearchTree::addNode(Bid bid) {
+
+    // allocate first: growing the pool would move the links recorded below
+    NodeIndex added = newNode(bid);
+    const string& bidId = bids[added].bidId;
+    const BidKey key = nodes[added].key;
+
+    vector<NodeIndex*> path;
+    NodeIndex* link = &root;
+
+    // find the empty link where the bid belongs
+    while (*link != NIL) {
+        path.push_back(link);
+        if (compareKey(*link, key, bidId) > 0) {
+            link = &nodes[*link].left; // add to left subtree
+        }
+        else {
+            link = &nodes[*link].right; // add to right subtree
+        }
+    }
+    *link = added; // new node becomes the child
+
+    if (mode == TreeMode::Splay) {
+        path.push_back(link);
+        splay(path);
+    }
+    else {
+        retrace(path);
+    }
+}
+/*
+* Traverse the tree in order
+* @param node Current node in tree
+* 
+* Author: Dylan Harmon
+* Date: 7/29/2025
+*/
+void BinarySearchTree::inOrder(NodeIndex node) {
+
+    if (node != NIL) {
+        inOrder(nodes[node].left);
+
+        std::cout << bids[node].bidId << ": " 
+            << bids[node].title << " | " 
+            << bids[node].amount << " | "
+            << bids[node].fund << endl;
+
+        inOrder(nodes[node].right);
+        }
+}
+/**
+ * Traverse the tree in post-order
+ * @param node Current node in tree
+ * 
+ * Author: Dylan Harmon
+ * Date: 7/29/2025
+ */
+void BinarySearchTree::postOrder(NodeIndex node) {
+     
+    if (node != NIL) {
+        postOrder(nodes[node].left);
+        postOrder(nodes[node].right);
+        std::cout << bids[node].bidId << ": "
+            << bids[node].title << " | "
+            << bids[node].amount << " | "
+            << bids[node].fund << endl;
+    }
+}
+/*
+*
+* Traverse the tree in pre-order
+* @param node Current node in tree
+* Author: Dylan Harmon
+* Date: 7/29/2025
+* 
+*/
+void BinarySearchTree::preOrder(NodeIndex node) {
+
+    if (node != NIL) {
+        std::cout << bids[node].bidId << ": "
+                    << bids[node].title << " | "
+                    << bids[node].amount << " | " 
+                    << bids[node].fund << endl;
+
+            preOrder(nodes[node].left);
+            preOrder(nodes[node].right);
+        }
+ }
+
+/**
+ * Remove a bid from the tree
+ *
+ * Iterative like addNode; the links followed (including the walk to an
+ * in-order successor) are retraced afterwards to restore balance.
+ *
+ * @param bidId Id of the bid to remove
+ * 
+ * Author: Dylan Harmon
+ * Date: 7/29/2025
+ */
+void BinarySearchTree::removeNode(string bidId) {
+
+    const BidKey key(bidId);
+    vector<NodeIndex*> path;
+    NodeIndex* link = &root;
+
+    // walk down to the matching node
+    int order;
+    while (*link != NIL && (order = compareKey(*link, key, bidId)) != 0) {
+        path.push_back(link);
+        if (order > 0) {
+            link = &nodes[*link].left; // check left node
+        }
+        else {
+            link = &nodes[*link].right; // check right node
+        }
+    }
+    if (*link == NIL) {
+        return; // not found, nothing to remove
+    }
+
+    NodeIndex target = *link;
+    // two children
+    if (nodes[target].left != NIL && nodes[target].right != NIL) {
+        // take the bid of the in-order successor, then unlink the successor
+        path.push_back(link);
+        NodeIndex* successor = &nodes[target].right;
+        while (nodes[*successor].left != NIL) { // keep moving left
+            path.push_back(successor);
+            successor = &nodes[*successor].left;
+        }
+        NodeIndex temp = *successor;
+        bids[target] = move(bids[temp]);
+        nodes[target].key = nodes[temp].key;
+        nodes[target].amount = nodes[temp].amount;
+        *successor = nodes[temp].right;
+        freeNode(temp);
+    }
+    // leaf or one child, splice the child into the parent's link
+    else {
+        *link = nodes[target].left != NIL ? nodes[target].left : nodes[target].right;
+        freeNode(target);
+    }
+
+    retrace(path);
+}
+
+/**
+ * Three-way compare a node's bid id against bidId, using the cached
+ * prefix keys and reading the bid's string only on a long-id tie
+ *
+ * @return <0, 0 or >0 as the node's id is less, equal or greater
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+int BinarySearchTree::compareKey(NodeIndex node, const BidKey& key, const string& bidId) const {
+    return compareBidIds(nodes[node].key, bids[node].bidId, key, bidId);
+}
+
+/**
+ * Copy every bid out in order
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+vector<Bid> BinarySearchTree::collect() {
+    return vector<Bid>(begin(), end());
+}
+
+/**
+ * Iterator at the smallest bid, or end() when empty
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+BinarySearchTree::Iterator BinarySearchTree::begin() {
+    Iterator it;
+    it.tree = this;
+    it.descend(root, true);
+    return it;
+}
+
+/**
+ * Iterator one past the largest bid
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+BinarySearchTree::Iterator BinarySearchTree::end() {
+    Iterator it;
+    it.tree = this;
+    return it;
+}
+
+/**
+ * Iterator at the first bid whose id is not less than bidId
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+BinarySearchTree::Iterator BinarySearchTree::LowerBound(string bidId) {
+    Iterator it;
+    it.tree = this;
+    const BidKey key(bidId);
+    size_t keep = 0; // path length up to the best candidate so far
+    for (NodeIndex node = root; node != NIL;) {
+        it.path.push_back(node);
+        if (compareKey(node, key, bidId) >= 0) {
+            keep = it.path.size();
+            node = nodes[node].left;
+        }
+        else {
+            node = nodes[node].right;
+        }
+    }
+    it.path.resize(keep);
+    return it;
+}
+
+/**
+ * Iterator at the first bid whose id is greater than bidId
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+BinarySearchTree::Iterator BinarySearchTree::UpperBound(string bidId) {
+    Iterator it;
+    it.tree = this;
+    const BidKey key(bidId);
+    size_t keep = 0;
+    for (NodeIndex node = root; node != NIL;) {
+        it.path.push_back(node);
+        if (compareKey(node, key, bidId) > 0) {
+            keep = it.path.size();
+            node = nodes[node].left;
+        }
+        else {
+            node = nodes[node].right;
+        }
+    }
+    it.path.resize(keep);
+    return it;
+}
+
+/**
+ * Visit every bid with lo <= bidId <= hi in order. Only the path to lo
+ * and the matching bids are touched: O(log n + k). visit must not change
+ * the tree, which in Splay mode includes calling Search.
+ *
+ * @param lo smallest id to visit
+ * @param hi largest id to visit
+ * @param visit callable taking const Bid&
+ * @return number of bids visited
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename Visitor>
+size_t BinarySearchTree::RangeScan(string lo, string hi, Visitor visit) {
+    size_t visited = 0;
+    const BidKey hiKey(hi);
+    for (Iterator it = LowerBound(lo); it != end() && compareKey(it.path.back(), hiKey, hi) <= 0; ++it) {
+        visit(*it);
+        ++visited;
+    }
+    return visited;
+}
+
+/**
+ * Cut the tree into subtrees of at most PARALLEL_GRAIN nodes plus the
+ * single nodes above them, in order. Uses an explicit stack because an
+ * unbalanced or splayed tree can be arbitrarily deep.
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+vector<BinarySearchTree::Chunk> BinarySearchTree::split() {
+    vector<Chunk> chunks;
+    vector<Chunk> above; // large nodes whose left side is still being cut
+    NodeIndex node = root;
+    size_t offset = 0;
+    while (true) {
+        if (node != NIL && nodes[node].size > PARALLEL_GRAIN) {
+            above.push_back(Chunk{ node, offset, false });
+            node = nodes[node].left;
+            continue;
+        }
+        if (node != NIL) {
+            chunks.push_back(Chunk{ node, offset, true });
+        }
+        if (above.empty()) {
+            break;
+        }
+        Chunk big = above.back();
+        above.pop_back();
+        big.offset += nodes[nodes[big.node].left].size;
+        chunks.push_back(big);
+        node = nodes[big.node].right;
+        offset = big.offset + 1;
+    }
+    return chunks;
+}
+
+/**
+ * Visit a subtree in order on the calling thread
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename Visitor>
+void BinarySearchTree::walk(NodeIndex node, Visitor& visit) {
+    vector<NodeIndex> stack;
+    while (node != NIL || !stack.empty()) {
+        while (node != NIL) {
+            stack.push_back(node);
+            node = nodes[node].left;
+        }
+        node = stack.back();
+        stack.pop_back();
+        visit(bids[node]);
+        node = nodes[node].right;
+    }
+}
+
+/**
+ * Visit every bid on the pool's workers. Calls run concurrently and in
+ * no particular order, so visit must be safe to call from several
+ * threads at once. The tree must not change until this returns; in
+ * Splay mode that rules out Search too, since it rotates the tree.
+ *
+ * @param pool workers to run on
+ * @param visit callable taking const Bid&
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename Visitor>
+void BinarySearchTree::ParallelForEach(ThreadPool& pool, Visitor visit) {
+    vector<Chunk> chunks = split();
+    ThreadPool::TaskGroup group(pool);
+    for (const Chunk& chunk : chunks) {
+        group.Run([this, chunk, visit]() mutable {
+            if (chunk.whole) {
+                walk(chunk.node, visit);
+            }
+            else {
+                visit(bids[chunk.node]);
+            }
+        });
+    }
+    group.Wait();
+}
+
+/**
+ * Fold every bid into a result on the pool's workers. Each task folds
+ * its part of the tree into its own copy of identity; the partial
+ * results are then combined on the calling thread in bidId order. The
+ * tree must not change until this returns, which in Splay mode rules
+ * out Search too.
+ *
+ * @param pool workers to run on
+ * @param identity starting value of every partial result
+ * @param fold callable (T& partial, const Bid& bid)
+ * @param combine callable (T& total, const T& partial)
+ * @return the combined result
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename T, typename Fold, typename Combine>
+T BinarySearchTree::ParallelReduce(ThreadPool& pool, T identity, Fold fold, Combine combine) {
+    vector<Chunk> chunks = split();
+    vector<T> partials(chunks.size(), identity);
+    {
+        ThreadPool::TaskGroup group(pool);
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            group.Run([this, &chunks, &partials, &fold, i]() {
+                T& partial = partials[i];
+                auto into = [&partial, &fold](const Bid& bid) { fold(partial, bid); };
+                if (chunks[i].whole) {
+                    walk(chunks[i].node, into);
+                }
+                else {
+                    into(bids[chunks[i].node]);
+                }
+            });
+        }
+        group.Wait();
+    }
+    for (const T& partial : partials) {
+        combine(identity, partial);
+    }
+    return identity;
+}
+
+/**
+ * Copy every bid out in bidId order using the pool's workers. Subtree
+ * sizes give every chunk its final position, so each task writes its
+ * bids straight into place and no merge pass is needed.
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+vector<Bid> BinarySearchTree::ParallelExport(ThreadPool& pool) {
+    vector<Bid> sorted(Size());
+    vector<Chunk> chunks = split();
+    ThreadPool::TaskGroup group(pool);
+    for (const Chunk& chunk : chunks) {
+        group.Run([this, chunk, &sorted]() {
+            size_t next = chunk.offset;
+            auto place = [&sorted, &next](const Bid& bid) { sorted[next++] = bid; };
+            if (chunk.whole) {
+                walk(chunk.node, place);
+            }
+            else {
+                place(bids[chunk.node]);
+            }
+        });
+    }
+    group.Wait();
+    return sorted;
+}
+
+/**
+ * Extend the path from node down its leftmost (or rightmost) spine
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void BinarySearchTree::Iterator::descend(NodeIndex node, bool leftmost) {
+    while (node != NIL) {
+        path.push_back(node);
+        node = leftmost ? tree->nodes[node].left : tree->nodes[node].right;
+    }
+}
+
+/**
+ * Step to the in-order successor
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+BinarySearchTree::Iterator& BinarySearchTree::Iterator::operator++() {
+    NodeIndex node = path.back();
+    if (tree->nodes[node].right != NIL) {
+        descend(tree->nodes[node].right, true);
+        return *this;
+    }
+    // climb until we leave a left subtree
+    path.pop_back();
+    while (!path.empty() && tree->nodes[path.back()].right == node) {
+        node = path.back();
+        path.pop_back();
+    }
+    return *this;
+}
+
+/**
+ * Step to the in-order predecessor; from end() this is the largest bid
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+BinarySearchTree::Iterator& BinarySearchTree::Iterator::operator--() {
+    if (path.empty()) {
+        descend(tree->root, false);
+        return *this;
+    }
+    NodeIndex node = path.back();
+    if (tree->nodes[node].left != NIL) {
+        descend(tree->nodes[node].left, false);
+        return *this;
+    }
+    // climb until we leave a right subtree
+    path.pop_back();
+    while (!path.empty() && tree->nodes[path.back()].left == node) {
+        node = path.back();
+        path.pop_back();
+    }
+    return *this;
+}
+
+/**
+ * Hand out a pool slot holding bid, reusing a freed slot if possible
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+NodeIndex BinarySearchTree::newNode(Bid bid) {
+    NodeIndex node;
+    if (!freeNodes.empty()) {
+        node = freeNodes.back();
+        freeNodes.pop_back();
+        nodes[node] = Node(bid);
+        bids[node] = move(bid);
+    }
+    else {
+        node = static_cast<NodeIndex>(nodes.size());
+        nodes.push_back(Node(bid));
+        bids.push_back(move(bid));
+    }
+    return node;
+}
+
+/**
+ * Return a pool slot to the free list
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void BinarySearchTree::freeNode(NodeIndex node) {
+    bids[node] = Bid(); // release the strings now
+    freeNodes.push_back(node);
+}
+
+/**
+ * Fold the cached totals of a possibly empty subtree into total
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void BinarySearchTree::addSubtree(BidAggregate& total, NodeIndex node) {
+    const Node& n = nodes[node];
+    total.add(n.size, n.amountSum, n.amountMin, n.amountMax);
+}
+
+/**
+ * Recompute the cached height, size and amount totals of node from
+ * its children. The NIL sentinel holds the identities, so no child
+ * needs a null check.
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void BinarySearchTree::update(NodeIndex node) {
+    Node& n = nodes[node];
+    const Node& left = nodes[n.left];
+    const Node& right = nodes[n.right];
+
+    n.height = 1 + max(left.height, right.height);
+    n.size = 1 + left.size + right.size;
+    n.amountSum = n.amount + left.amountSum + right.amountSum;
+    n.amountMin = min(n.amount, min(left.amountMin, right.amountMin));
+    n.amountMax = max(n.amount, max(left.amountMax, right.amountMax));
+}
+
+/**
+ * Rotate node down to the left; its right child takes its place
+ *
+ * @return the new subtree root
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+NodeIndex BinarySearchTree::rotateLeft(NodeIndex node) {
+    NodeIndex pivot = nodes[node].right;
+    nodes[node].right = nodes[pivot].left;
+    nodes[pivot].left = node;
+    update(node);
+    update(pivot);
+    return pivot;
+}
+
+/**
+ * Rotate node down to the right; its left child takes its place
+ *
+ * @return the new subtree root
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+NodeIndex BinarySearchTree::rotateRight(NodeIndex node) {
+    NodeIndex pivot = nodes[node].left;
+    nodes[node].left = nodes[pivot].right;
+    nodes[pivot].right = node;
+    update(node);
+    update(pivot);
+    return pivot;
+}
+
+/**
+ * Restore the AVL property at node, assuming both subtrees are balanced
+ *
+ * @return the new subtree root
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+NodeIndex BinarySearchTree::rebalance(NodeIndex node) {
+    update(node);
+    NodeIndex left = nodes[node].left;
+    NodeIndex right = nodes[node].right;
+    int balance = nodes[left].height - nodes[right].height;
+
+    // left heavy
+    if (balance > 1) {
+        if (nodes[nodes[left].left].height < nodes[nodes[left].right].height) {
+            nodes[node].left = rotateLeft(left); // left-right case
+        }
+        return rotateRight(node);
+    }
+    // right heavy
+    if (balance < -1) {
+        if (nodes[nodes[right].right].height < nodes[nodes[right].left].height) {
+            nodes[node].right = rotateRight(right); // right-left case
+        }
+        return rotateLeft(node);
+    }
+    return node;
+}
+
+/**
+ * Walk back up a recorded root-to-leaf path, refreshing heights and,
+ * in AVL mode, rotating any node that fell out of balance.
+ *
+ * @param path links followed from the root, outermost first
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void BinarySearchTree::retrace(vector<NodeIndex*>& path) {
+    for (auto link = path.rbegin(); link != path.rend(); ++link) {
+        if (mode == TreeMode::AVL) {
+            **link = rebalance(**link);
+        }
+        else {
+            update(**link);
+        }
+    }
+}
+
+/**
+ * Rotate the last node of a recorded path up to the root with zig-zig
+ * and zig-zag steps, which roughly halves the depth of every node on
+ * the way. Repeatedly used bids therefore stay within a level or two of
+ * the root, and any sequence of operations costs O(log n) amortized.
+ *
+ * @param path links followed from the root, the last one to the node
+ *             to splay; every node below it must already be up to date
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void BinarySearchTree::splay(vector<NodeIndex*>& path) {
+    size_t depth = path.size();
+    while (depth > 1) {
+        NodeIndex* parentLink = path[depth - 2];
+        NodeIndex parent = *parentLink;
+        bool leftChild = nodes[parent].left == *path[depth - 1];
+
+        // zig: the parent is the root
+        if (depth == 2) {
+            *parentLink = leftChild ? rotateRight(parent) : rotateLeft(parent);
+            break;
+        }
+
+        NodeIndex* grandLink = path[depth - 3];
+        NodeIndex grand = *grandLink;
+        bool parentLeft = nodes[grand].left == parent;
+        if (leftChild == parentLeft) {
+            // zig-zig: rotate the grandparent first, then the parent
+            *grandLink = parentLeft ? rotateRight(grand) : rotateLeft(grand);
+            *grandLink = parentLeft ? rotateRight(*grandLink) : rotateLeft(*grandLink);
+        }
+        else {
+            // zig-zag: rotate the node above its parent, then its grandparent
+            *parentLink = leftChild ? rotateRight(parent) : rotateLeft(parent);
+            *grandLink = parentLeft ? rotateRight(grand) : rotateLeft(grand);
+        }
+        depth -= 2;
+    }
+}
+
+
+//============================================================================
+// Static methods used for testing
+//============================================================================
+
+/**
+ * Display the bid information to the console (std::out)
+ *
+ * @param bid struct containing the bid info
+ */
+void displayBid(Bid bid) {
+    cout << bid.bidId << ": " << bid.title << " | " << bid.amount << " | "
+            << bid.fund << endl;
+    return;
+}
+
+/**
+ * Read a CSV file containing bids into a vector
+ *
+ * @param csvPath the path to the CSV file to load
+ * @return a vector holding all the bids read
+ */
+vector<Bid> readBids(string csvPath) {
+    cout << "Loading CSV file " << csvPath << endl;
+
+    vector<Bid> bids;
+
+    // initialize the CSV Parser using the given path
+    csv::Parser file = csv::Parser(csvPath);
+
+    // read and display header row - optional
+    vector<string> header = file.getHeader();
+    for (auto const& c : header) {
+        cout << c << " | ";
+    }
+    cout << "" << endl;
+
+    try {
+        // loop to read rows of a CSV file
+        for (unsigned int i = 0; i < file.rowCount(); i++) {
+
+            // Create a data structure and add to the collection of bids
+            Bid bid;
+            bid.bidId = file[i][1];
+            bid.title = file[i][0];
+            bid.fund = file[i][8];
+            bid.amount = strToDouble(file[i][4], '$');
+
+            //cout << "Item: " << bid.title << ", Fund: " << bid.fund << ", Amount: " << bid.amount << endl;
+
+            // push this bid to the end
+            bids.push_back(bid);
+        }
+    } catch (csv::Error &e) {
+        std::cerr << e.what() << std::endl;
+    }
+    return bids;
+}
+
+/**
+ * Load a CSV file containing bids into a container
+ *
+ * @param csvPath the path to the CSV file to load
+ * @param bst the tree to insert the bids into
+ */
+void loadBids(string csvPath, BinarySearchTree* bst) {
+    bst->BulkLoad(readBids(csvPath));
+}
+
+/**
+ * Print the elapsed time of one benchmark step
+ *
+ * @param label what was timed
+ * @param ticks elapsed clock ticks
+ */
+void reportTime(const string& label, clock_t ticks) {
+    cout << "  " << label << ": " << ticks << " clock ticks, "
+        << ticks * 1.0 / CLOCKS_PER_SEC << " seconds" << endl;
+}
+
+/**
+ * Print a wall-clock time for the benchmarks. clock() adds up the CPU
+ * time of every thread, which hides any speedup from running in parallel.
+ *
+ * @param label what was timed
+ * @param elapsed wall-clock time taken
+ */
+void reportSeconds(const string& label, chrono::steady_clock::duration elapsed) {
+    cout << "  " << label << ": " << chrono::duration<double>(elapsed).count()
+        << " seconds" << endl;
+}
+
+/**
+ * Time Zipf-distributed lookups, where a few hot bids take most of the
+ * queries, against the plain, AVL and splay tree modes
+ *
+ * @param bids the bids to load
+ * @return sum of the amounts found, to keep the lookups from being optimized out
+ */
+double benchmarkSkewed(const vector<Bid>& bids) {
+    const size_t QUERIES = 500000;
+    const double SKEWS[] = { 0.8, 1.0, 1.2, 1.5 }; // rank r is queried with weight 1 / r^skew
+    double checksum = 0.0;
+    if (bids.empty()) {
+        return checksum;
+    }
+
+    // hand out popularity ranks in random order so hot ids are spread over the key space
+    mt19937 rng(42);
+    vector<size_t> byRank(bids.size());
+    for (size_t i = 0; i < byRank.size(); ++i) {
+        byRank[i] = i;
+    }
+    shuffle(byRank.begin(), byRank.end(), rng);
+
+    // load the plain tree in random order; file order may be sorted and would give a list
+    vector<Bid> shuffled(bids);
+    shuffle(shuffled.begin(), shuffled.end(), rng);
+
+    const TreeMode modes[] = { TreeMode::Unbalanced, TreeMode::AVL, TreeMode::Splay };
+    const char* names[] = { "Unbalanced (random insert order)", "AVL", "Splay" };
+    for (double skew : SKEWS) {
+        vector<double> cumulative(bids.size());
+        double total = 0.0;
+        for (size_t r = 0; r < cumulative.size(); ++r) {
+            total += 1.0 / pow(static_cast<double>(r + 1), skew);
+            cumulative[r] = total;
+        }
+        uniform_real_distribution<double> pick(0.0, total);
+        vector<const string*> queries(QUERIES);
+        for (const string*& query : queries) {
+            size_t r = lower_bound(cumulative.begin(), cumulative.end(), pick(rng)) - cumulative.begin();
+            query = &bids[byRank[min(r, bids.size() - 1)]].bidId;
+        }
+
+        cout << "Zipf lookups (s = " << skew << ", " << QUERIES << " queries)" << endl;
+        for (size_t m = 0; m < 3; ++m) {
+            BinarySearchTree tree(modes[m]);
+            for (const Bid& bid : modes[m] == TreeMode::Unbalanced ? shuffled : bids) {
+                tree.Insert(bid);
+            }
+            clock_t ticks = clock();
+            for (const string* query : queries) {
+                checksum += tree.Search(*query).amount;
+            }
+            reportTime(names[m], clock() - ticks);
+        }
+    }
+    return checksum;
+}
+
+/**
+ * Time loading, looking up and scanning the same bids in each of the
+ * ordered engines
+ *
+ * @param bids the bids to load
+ */
+void benchmarkEngines(const vector<Bid>& bids) {
+    // repeat the lookups so small files still give measurable times
+    const size_t rounds = max<size_t>(1, 1000000 / max<size_t>(1, bids.size()));
+    clock_t ticks;
+    double checksum = 0.0;
+
+    cout << bids.size() << " bids, " << rounds << " lookup rounds" << endl;
+
+    cout << "BinarySearchTree (AVL)" << endl;
+    BinarySearchTree bst;
+    ticks = clock();
+    for (const Bid& bid : bids) {
+        bst.Insert(bid);
+    }
+    reportTime("load", clock() - ticks);
+    ticks = clock();
+    for (size_t r = 0; r < rounds; ++r) {
+        for (const Bid& bid : bids) {
+            checksum += bst.Search(bid.bidId).amount;
+        }
+    }
+    reportTime("lookups", clock() - ticks);
+
+    cout << "BinarySearchTree (BulkLoad)" << endl;
+    BinarySearchTree bulk;
+    vector<Bid> toLoad(bids);
+    ticks = clock();
+    bulk.BulkLoad(move(toLoad));
+    reportTime("load", clock() - ticks);
+
+    cout << "EytzingerIndex (frozen BinarySearchTree)" << endl;
+    ticks = clock();
+    bst.Freeze();
+    reportTime("freeze", clock() - ticks);
+    ticks = clock();
+    for (size_t r = 0; r < rounds; ++r) {
+        for (const Bid& bid : bids) {
+            checksum += bst.FrozenSearch(bid.bidId).amount;
+        }
+    }
+    reportTime("lookups", clock() - ticks);
+
+    cout << "BPlusTree" << endl;
+    BPlusTree bpt;
+    ticks = clock();
+    for (const Bid& bid : bids) {
+        bpt.Insert(bid);
+    }
+    bpt.Compact();
+    reportTime("load", clock() - ticks);
+    ticks = clock();
+    for (size_t r = 0; r < rounds; ++r) {
+        for (const Bid& bid : bids) {
+            checksum += bpt.Search(bid.bidId).amount;
+        }
+    }
+    reportTime("lookups", clock() - ticks);
+    ticks = clock();
+    for (size_t r = 0; r < rounds; ++r) {
+        bpt.ForEach([&checksum](const Bid& bid) { checksum += bid.amount; });
+    }
+    reportTime("in-order scans", clock() - ticks);
+
+    cout << "OrderedMap<string, Bid>" << endl;
+    OrderedMap<string, Bid> ordered;
+    ticks = clock();
+    for (const Bid& bid : bids) {
+        ordered.Insert(bid.bidId, bid);
+    }
+    reportTime("load", clock() - ticks);
+    ticks = clock();
+    for (size_t r = 0; r < rounds; ++r) {
+        for (const Bid& bid : bids) {
+            const Bid* found = ordered.Find(bid.bidId);
+            checksum += found != nullptr ? found->amount : 0.0;
+        }
+    }
+    reportTime("lookups", clock() - ticks);
+
+    cout << "AdaptiveRadixTree" << endl;
+    AdaptiveRadixTree art;
+    ticks = clock();
+    for (const Bid& bid : bids) {
+        art.Insert(bid);
+    }
+    reportTime("load", clock() - ticks);
+    ticks = clock();
+    for (size_t r = 0; r < rounds; ++r) {
+        for (const Bid& bid : bids) {
+            const Bid* found = art.Find(bid.bidId);
+            checksum += found != nullptr ? found->amount : 0.0;
+        }
+    }
+    reportTime("lookups", clock() - ticks);
+    ticks = clock();
+    for (size_t r = 0; r < rounds; ++r) {
+        art.ForEach([&checksum](const Bid& bid) { checksum += bid.amount; });
+    }
+    reportTime("in-order scans", clock() - ticks);
+
+    cout << "HashTable<string, Bid> (unordered)" << endl;
+    HashTable<string, Bid> table;
+    ticks = clock();
+    for (const Bid& bid : bids) {
+        table.Insert(bid.bidId, bid);
+    }
+    reportTime("load", clock() - ticks);
+    ticks = clock();
+    for (size_t r = 0; r < rounds; ++r) {
+        for (const Bid& bid : bids) {
+            const Bid* found = table.Find(bid.bidId);
+            checksum += found != nullptr ? found->amount : 0.0;
+        }
+    }
+    reportTime("lookups", clock() - ticks);
+
+    // structure only: bids are stored once by both, but the table keeps its own key copy
+    size_t tableBytes = table.BucketCount() * sizeof(void*)
+        + table.Size() * (sizeof(void*) + sizeof(size_t) + sizeof(string));
+    cout << "index bytes per bid: AdaptiveRadixTree "
+        << art.IndexBytes() * 1.0 / max<size_t>(1, art.Size())
+        << ", HashTable " << tableBytes * 1.0 / max<size_t>(1, table.Size()) << endl;
+
+    // one thread loads while the others keep querying whatever version is current
+    unsigned cores = thread::hardware_concurrency();
+    unsigned readers = cores > 2 ? min(cores - 1, 4u) : 1;
+    cout << "SnapshotTree (1 writer, " << readers << " readers)" << endl;
+    SnapshotTree snapshots;
+    atomic<bool> loading(true);
+    atomic<size_t> served(0);
+    vector<thread> queries;
+    for (unsigned i = 0; i < readers; ++i) {
+        queries.emplace_back([&bids, &snapshots, &loading, &served]() {
+            size_t done = 0;
+            while (loading.load()) {
+                SnapshotTree::Snapshot view = snapshots.Read();
+                for (size_t j = 0; j < bids.size() && loading.load(); j += 64) {
+                    view.Search(bids[j].bidId);
+                    ++done;
+                }
+            }
+            served += done;
+        });
+    }
+    // clock() would add up the readers' CPU time too, so time the writer by wall clock
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (const Bid& bid : bids) {
+        snapshots.Insert(bid);
+    }
+    chrono::steady_clock::duration elapsed = chrono::steady_clock::now() - start;
+    loading = false;
+    for (thread& query : queries) {
+        query.join();
+    }
+    reportSeconds("load", elapsed);
+    cout << "  " << served.load() << " snapshot lookups served during the load" << endl;
+    SnapshotTree::Snapshot view = snapshots.Read();
+    ticks = clock();
+    for (size_t r = 0; r < rounds; ++r) {
+        for (const Bid& bid : bids) {
+            checksum += view.Search(bid.bidId).amount;
+        }
+    }
+    reportTime("lookups", clock() - ticks);
+
+    // whole-tree analytics, one core against all of them
+    ThreadPool pool;
+    cout << "Parallel analytics (" << pool.Size() << " threads)" << endl;
+    typedef OrderedMap<string, double> FundTotals;
+    auto addToFund = [](FundTotals& totals, const Bid& bid) { totals[bid.fund] += bid.amount; };
+    auto mergeFunds = [](FundTotals& totals, const FundTotals& part) {
+        part.ForEach([&totals](const string& fund, const double& amount) { totals[fund] += amount; });
+    };
+    start = chrono::steady_clock::now();
+    for (size_t r = 0; r < rounds; ++r) {
+        FundTotals totals;
+        for (const Bid& bid : bulk) {
+            addToFund(totals, bid);
+        }
+        checksum += totals.Size();
+    }
+    reportSeconds("sum by fund, 1 thread", chrono::steady_clock::now() - start);
+    start = chrono::steady_clock::now();
+    for (size_t r = 0; r < rounds; ++r) {
+        checksum += bulk.ParallelReduce(pool, FundTotals(), addToFund, mergeFunds).Size();
+    }
+    reportSeconds("sum by fund, parallel", chrono::steady_clock::now() - start);
+    start = chrono::steady_clock::now();
+    for (size_t r = 0; r < rounds; ++r) {
+        checksum += vector<Bid>(bulk.begin(), bulk.end()).size();
+    }
+    reportSeconds("in-order export, 1 thread", chrono::steady_clock::now() - start);
+    start = chrono::steady_clock::now();
+    for (size_t r = 0; r < rounds; ++r) {
+        checksum += bulk.ParallelExport(pool).size();
+    }
+    reportSeconds("in-order export, parallel", chrono::steady_clock::now() - start);
+
+    checksum += benchmarkSkewed(bids);
+    cout << "checksum: " << checksum << endl;
+}
+
+/**
+ * Simple C function to convert a string to a double
+ * after stripping out unwanted char
+ *
+ * credit: http://stackoverflow.com/a/24875936
+ *
+ * @param ch The character to strip out
+ */
+double strToDouble(string str, char ch) {
+    str.erase(remove(str.begin(), str.end(), ch), str.end());
+    return atof(str.c_str());
+}
+
+/**
+ * Look up a tree mode by the name given on the command line
+ *
+ * @param name "unbalanced", "avl" or "splay"
+ * @param mode set to the named mode when the name is known
+ * @return true if the name is known
+ */
+bool parseTreeMode(const string& name, TreeMode& mode) {
+    if (name == "unbalanced") {
+        mode = TreeMode::Unbalanced;
+    }
+    else if (name == "avl") {
+        mode = TreeMode::AVL;
+    }
+    else if (name == "splay") {
+        mode = TreeMode::Splay;
+    }
+    else {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * The one and only main() method
+ *
+ * Usage: BinarySearchTree [csvPath [bidKey [unbalanced|avl|splay]]]
+ */
+int main(int argc, char* argv[]) {
+
+    // process command line arguments
+    string csvPath, bidKey;
+    TreeMode mode = TreeMode::AVL;
+    switch (argc) {
+    case 4:
+        csvPath = argv[1];
+        bidKey = argv[2];
+        if (!parseTreeMode(argv[3], mode)) {
+            cout << "Unknown tree mode " << argv[3] << ", using avl" << endl;
+        }
+        break;
+    case 2:
+        csvPath = argv[1];
+        bidKey = "98223";
+        break;
+    case 3:
+        csvPath = argv[1];
+        bidKey = argv[2];
+        break;
+    default:
+        csvPath = "eBid_Monthly_Sales.csv";
+        bidKey = "98223";
+    }
+
+    // Define a timer variable
+    clock_t ticks;
+
+    // Define a binary search tree to hold all bids
+    BinarySearchTree* bst;
+    bst = new BinarySearchTree(mode);
+    Bid bid;
+
+    int choice = 0;
+    while (choice != 9) {
+        cout << "Menu:" << endl;
+        cout << "  1. Load Bids" << endl;
+        cout << "  2. Display All Bids" << endl;
+        cout << "  3. Find Bid" << endl;
+        cout << "  4. Remove Bid" << endl;
+        cout << "  5. Benchmark Engines" << endl;
+        cout << "  6. Display Bids in Range" << endl;
+        cout << "  7. Display Page of Bids" << endl;
+        cout << "  8. Total Bids in Range" << endl;
+        cout << "  9. Exit" << endl;
+        cout << "Enter choice: ";
+        cin >> choice;
+
+        switch (choice) {
+
+        case 1:
+            
+            // Initialize a timer variable before loading bids
+            ticks = clock();
+
+            // Complete the method call to load the bids
+            loadBids(csvPath, bst);
+
+            cout << bst->Size() << " bids read" << endl;
+
+            // Calculate elapsed time and display result
+            ticks = clock() - ticks; // current clock ticks minus starting clock ticks
+            cout << "time: " << ticks << " clock ticks" << endl;
+            cout << "time: " << ticks * 1.0 / CLOCKS_PER_SEC << " seconds" << endl;
+            break;
+
+        case 2:
+            bst->InOrder();
+            break;
+
+        case 3:
+            ticks = clock();
+
+            bid = bst->Search(bidKey);
+
+            ticks = clock() - ticks; // current clock ticks minus starting clock ticks
+
+            if (!bid.bidId.empty()) {
+                displayBid(bid);
+            } else {
+            	cout << "Bid Id " << bidKey << " not found." << endl;
+            }
+
+            cout << "time: " << ticks << " clock ticks" << endl;
+            cout << "time: " << ticks * 1.0 / CLOCKS_PER_SEC << " seconds" << endl;
+
+            break;
+
+        case 4:
+            bst->Remove(bidKey);
+            break;
+
+        case 5:
+            benchmarkEngines(readBids(csvPath));
+            break;
+
+        case 6: {
+            string lo, hi;
+            cout << "Enter lowest and highest bid id: ";
+            cin >> lo >> hi;
+
+            ticks = clock();
+            size_t found = bst->RangeScan(lo, hi, displayBid);
+            ticks = clock() - ticks;
+
+            cout << found << " bids in range" << endl;
+            cout << "time: " << ticks << " clock ticks" << endl;
+            cout << "time: " << ticks * 1.0 / CLOCKS_PER_SEC << " seconds" << endl;
+            break;
+        }
+
+        case 7: {
+            const size_t pageSize = 20;
+            size_t page;
+            cout << "Enter page number (starting at 1): ";
+            cin >> page;
+
+            // jump straight to the first bid on the page
+            BinarySearchTree::Iterator it = bst->Nth((max<size_t>(page, 1) - 1) * pageSize);
+            for (size_t i = 0; i < pageSize && it != bst->end(); ++i, ++it) {
+                displayBid(*it);
+            }
+            cout << "page " << max<size_t>(page, 1) << " of "
+                << (bst->Size() + pageSize - 1) / pageSize << endl;
+            break;
+        }
+
+        case 8: {
+            string lo, hi;
+            cout << "Enter lowest and highest bid id: ";
+            cin >> lo >> hi;
+
+            BidAggregate total = bst->RangeAggregate(lo, hi);
+            cout << total.count << " bids in range" << endl;
+            if (total.count > 0) {
+                cout << "total: " << total.sum << " | min: " << total.min
+                    << " | max: " << total.max << endl;
+            }
+            break;
+        }
+        }
+    }
+
+    cout << "Good bye." << endl;
+
+	return 0;
+}
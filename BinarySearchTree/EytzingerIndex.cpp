@@ -0,0 +1,136 @@
+//============================================================================
+// Name        : EytzingerIndex.cpp
+// Author      : Dylan Harmon
+// Version     : 1.0
+// Description : Read-only bid index in Eytzinger (BFS) array layout
+//============================================================================
+
+#include <algorithm>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#include <xmmintrin.h>
+#endif
+
+#include "EytzingerIndex.hpp"
+
+using namespace std;
+
+namespace {
+
+    // hint that an address will be read soon
+    inline void prefetch(const void* address) {
+#if defined(_MSC_VER)
+        _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+        __builtin_prefetch(address);
+#endif
+    }
+
+    // number of trailing 1 bits in value
+    inline unsigned trailingOnes(uint64_t value) {
+        uint64_t zeros = ~value;
+        if (zeros == 0) {
+            return 64;
+        }
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward64(&index, zeros);
+        return static_cast<unsigned>(index);
+#else
+        return static_cast<unsigned>(__builtin_ctzll(zeros));
+#endif
+    }
+}
+
+/**
+ * Place sorted keys into Eytzinger slots with an in-order walk of the
+ * implicit tree
+ *
+ * @param slot current Eytzinger slot
+ * @param next next sorted position to place
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void EytzingerIndex::layout(size_t slot, size_t& next) {
+    if (slot >= prefix.size()) {
+        return;
+    }
+    layout(2 * slot, next);
+    prefix[slot] = keys[next].prefix;
+    rank[slot] = static_cast<uint32_t>(next);
+    ++next;
+    layout(2 * slot + 1, next);
+}
+
+/**
+ * Build the index from bids already sorted by bidId
+ *
+ * @param sorted bids in ascending bidId order
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void EytzingerIndex::Build(vector<Bid> sorted) {
+    bids = move(sorted);
+
+    keys.resize(bids.size());
+    for (size_t i = 0; i < bids.size(); ++i) {
+        keys[i] = BidKey(bids[i].bidId);
+    }
+
+    prefix.assign(bids.size() + 1, 0);
+    rank.assign(bids.size() + 1, 0);
+    size_t next = 0;
+    layout(1, next);
+}
+
+/**
+ * Search for a bid
+ *
+ * @return the first bid with a matching id, or an empty bid
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+Bid EytzingerIndex::Search(const string& bidId) const {
+    const size_t n = bids.size();
+    if (n == 0) {
+        return Bid();
+    }
+
+    const BidKey key(bidId);
+    const uint64_t* slots = prefix.data();
+
+    // branchless descent: go right while the slot is smaller than the key.
+    // slot 8k starts the line holding k's descendants three levels down.
+    size_t k = 1;
+    while (k <= n) {
+        prefetch(slots + min(8 * k, n));
+        k = 2 * k + (slots[k] < key.prefix);
+    }
+    // undo the trailing right turns to land on the lower bound
+    k >>= trailingOnes(k) + 1;
+    if (k == 0) {
+        return Bid(); // every key is smaller
+    }
+
+    // walk forward over keys sharing the prefix to settle the full id
+    for (size_t i = rank[k]; i < n && keys[i].prefix == key.prefix; ++i) {
+        int order = compareBidIds(keys[i], bids[i].bidId, key, bidId);
+        if (order == 0) {
+            return bids[i];
+        }
+        if (order > 0) {
+            break;
+        }
+    }
+    return Bid();
+}
+
+/**
+ * Number of bids indexed
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+size_t EytzingerIndex::Size() const {
+    return bids.size();
+}
@@ -0,0 +1,49 @@
+//============================================================================
+// Name        : EytzingerIndex.hpp
+// Author      : Dylan Harmon
+// Version     : 1.0
+// Description : Read-only bid index in Eytzinger (BFS) array layout
+//============================================================================
+
+#ifndef EYTZINGERINDEX_HPP_
+#define EYTZINGERINDEX_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Bid.hpp"
+
+//============================================================================
+// Eytzinger Index class definition
+//============================================================================
+
+/**
+ * Frozen, pointer-free search index over a sorted set of bids.
+ *
+ * Key prefixes are stored in Eytzinger order: the root at slot 1 and the
+ * children of slot k at 2k and 2k + 1. A lookup is then a branchless
+ * descent over one array where the next few levels are always on the
+ * cache line being prefetched. The bids and their full keys are kept in
+ * sorted order beside it to settle prefix ties and return results.
+ *
+ * The index never changes after Build; rebuild it after the source
+ * changes.
+ */
+class EytzingerIndex {
+
+private:
+    std::vector<uint64_t> prefix;   // key prefixes in Eytzinger order, slot 0 unused
+    std::vector<uint32_t> rank;     // Eytzinger slot -> sorted position
+    std::vector<BidKey> keys;       // keys in sorted order
+    std::vector<Bid> bids;          // bids in sorted order
+
+    void layout(size_t slot, size_t& next);
+
+public:
+    void Build(std::vector<Bid> sorted);
+    Bid Search(const std::string& bidId) const;
+    size_t Size() const;
+};
+
+#endif /* EYTZINGERINDEX_HPP_ */
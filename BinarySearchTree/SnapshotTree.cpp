@@ -0,0 +1,389 @@
+//============================================================================
+// Name        : SnapshotTree.cpp
+// Author      : Dylan Harmon
+// Version     : 1.0
+// Description : Copy-on-write AVL tree of bids with lock-free snapshot reads
+//============================================================================
+
+#include <algorithm>
+#include <limits>
+
+#include "SnapshotTree.hpp"
+
+using namespace std;
+
+/**
+ * Default constructor
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+SnapshotTree::SnapshotTree() : root(nullptr), epoch(1), readers(nullptr) {
+}
+
+/**
+ * Destructor; frees every version and reader record, so no snapshot may
+ * still be open
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+SnapshotTree::~SnapshotTree() {
+    retired.clear();
+    current = NodeRef();
+    Reader* reader = readers.load();
+    while (reader != nullptr) {
+        Reader* next = reader->next;
+        delete reader;
+        reader = next;
+    }
+}
+
+/**
+ * Take a snapshot of the current version
+ *
+ * Claims a free reader record, or adds a new one when every record is
+ * in use, and announces the current epoch in it before loading the
+ * root. Neither step waits: a failed claim moves on to the next record.
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+SnapshotTree::Snapshot SnapshotTree::Read() const {
+    uint64_t announced = epoch.load();
+    Reader* head = readers.load();
+    for (Reader* reader = head; reader != nullptr; reader = reader->next) {
+        uint64_t free = 0;
+        if (reader->epoch.load(memory_order_relaxed) == 0
+            && reader->epoch.compare_exchange_strong(free, announced)) {
+            return Snapshot(reader, root.load());
+        }
+    }
+
+    // every record is in use; only happens when more snapshots are open than ever before
+    Reader* reader = new Reader;
+    reader->epoch.store(announced);
+    reader->next = head;
+    while (!readers.compare_exchange_weak(reader->next, reader)) {
+    }
+    return Snapshot(reader, root.load());
+}
+
+/**
+ * Insert a bid and publish the new version
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void SnapshotTree::Insert(Bid bid) {
+    Entry* entry = new Entry;
+    entry->key = BidKey(bid.bidId);
+    entry->bid = move(bid);
+    entry->refs = 1;
+    NodeRef leaf(new Node{ entry, nullptr, nullptr, 1, 1, 0 });
+
+    lock_guard<mutex> lock(writer);
+    publish(insert(current, leaf));
+}
+
+/**
+ * Remove the first bid matching bidId and publish the new version
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void SnapshotTree::Remove(string bidId) {
+    const BidKey key(bidId);
+    bool removed = false;
+
+    lock_guard<mutex> lock(writer);
+    NodeRef next = remove(current, key, bidId, removed);
+    if (removed) {
+        publish(move(next));
+    }
+}
+
+/**
+ * Number of bids in the current version
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+size_t SnapshotTree::Size() const {
+    return Read().Size();
+}
+
+/**
+ * Make next the current version: store its root for new snapshots,
+ * retire the version it replaces in the current epoch, move the epoch
+ * on, and free whatever no open snapshot can still reach
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void SnapshotTree::publish(NodeRef next) {
+    root.store(next.get());
+    uint64_t retiredIn = epoch.load();
+    retired.push_back(Retired{ retiredIn, move(current) });
+    current = move(next);
+    epoch.store(retiredIn + 1);
+    reclaim();
+}
+
+/**
+ * Free the retired versions that every open snapshot is newer than. A
+ * snapshot that announced an epoch later than a version's retirement
+ * loaded its root after that version was replaced.
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void SnapshotTree::reclaim() {
+    uint64_t oldest = numeric_limits<uint64_t>::max();
+    for (Reader* reader = readers.load(); reader != nullptr; reader = reader->next) {
+        uint64_t announced = reader->epoch.load();
+        if (announced != 0) {
+            oldest = min(oldest, announced);
+        }
+    }
+    while (!retired.empty() && retired.front().epoch < oldest) {
+        retired.pop_front(); // drops the version's hold on its nodes
+    }
+}
+
+/**
+ * Open a snapshot on a claimed reader record
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+SnapshotTree::Snapshot::Snapshot(Reader* aReader, const Node* aRoot) : reader(aReader), root(aRoot) {
+}
+
+/**
+ * Move constructor; the record now belongs to this snapshot
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+SnapshotTree::Snapshot::Snapshot(Snapshot&& other) noexcept : reader(other.reader), root(other.root) {
+    other.reader = nullptr;
+    other.root = nullptr;
+}
+
+/**
+ * Move assignment; closes this snapshot and takes over other's record
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+SnapshotTree::Snapshot& SnapshotTree::Snapshot::operator=(Snapshot&& other) noexcept {
+    if (this != &other) {
+        if (reader != nullptr) {
+            reader->epoch.store(0);
+        }
+        reader = other.reader;
+        root = other.root;
+        other.reader = nullptr;
+        other.root = nullptr;
+    }
+    return *this;
+}
+
+/**
+ * Destructor; hands the reader record back, ending the announcement
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+SnapshotTree::Snapshot::~Snapshot() {
+    if (reader != nullptr) {
+        reader->epoch.store(0);
+    }
+}
+
+/**
+ * Search this version for a bid
+ *
+ * @return the matching bid, or an empty bid if not found
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+Bid SnapshotTree::Snapshot::Search(const string& bidId) const {
+    const BidKey key(bidId);
+    const Node* node = root;
+    while (node != nullptr) {
+        int order = compareBidIds(node->entry->key, node->entry->bid.bidId, key, bidId);
+        if (order == 0) {
+            return node->entry->bid;
+        }
+        node = order > 0 ? node->left : node->right;
+    }
+    return Bid();
+}
+
+/**
+ * Number of bids in this version
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+size_t SnapshotTree::Snapshot::Size() const {
+    return size(root);
+}
+
+/**
+ * Count one more holder of a node
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void SnapshotTree::acquire(Node* node) {
+    if (node != nullptr) {
+        ++node->refs;
+    }
+}
+
+/**
+ * Count one less holder of a node, freeing it, its entry and its
+ * children's holds when it was the last
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void SnapshotTree::release(Node* node) {
+    if (node == nullptr || --node->refs > 0) {
+        return;
+    }
+    release(node->left);
+    release(node->right);
+    if (--node->entry->refs == 0) {
+        delete node->entry;
+    }
+    delete node;
+}
+
+/**
+ * Height of a possibly empty subtree
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+int SnapshotTree::height(const Node* node) {
+    return node != nullptr ? node->height : 0;
+}
+
+/**
+ * Size of a possibly empty subtree
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+size_t SnapshotTree::size(const Node* node) {
+    return node != nullptr ? node->size : 0;
+}
+
+/**
+ * New node carrying from's bid over the given children
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+SnapshotTree::NodeRef SnapshotTree::make(const Node* from, NodeRef left, NodeRef right) {
+    Node* node = new Node;
+    node->entry = from->entry;
+    ++node->entry->refs;
+    node->height = 1 + max(height(left.get()), height(right.get()));
+    node->size = 1 + size(left.get()) + size(right.get());
+    node->left = left.get();
+    node->right = right.get();
+    node->refs = 0;
+    acquire(node->left);
+    acquire(node->right);
+    return NodeRef(node);
+}
+
+/**
+ * New node carrying from's bid over the given children, rotated as
+ * needed so the result is AVL-balanced. Rotations build new nodes
+ * instead of relinking old ones, which may be visible to readers.
+ *
+ * @return the new subtree root
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+SnapshotTree::NodeRef SnapshotTree::balance(const Node* from, NodeRef left, NodeRef right) {
+    // left heavy
+    if (height(left.get()) > height(right.get()) + 1) {
+        if (height(left->left) < height(left->right)) {
+            const Node* pivot = left->right; // left-right case
+            return make(pivot, make(left.get(), NodeRef(left->left), NodeRef(pivot->left)),
+                make(from, NodeRef(pivot->right), move(right)));
+        }
+        return make(left.get(), NodeRef(left->left), make(from, NodeRef(left->right), move(right)));
+    }
+    // right heavy
+    if (height(right.get()) > height(left.get()) + 1) {
+        if (height(right->right) < height(right->left)) {
+            const Node* pivot = right->left; // right-left case
+            return make(pivot, make(from, move(left), NodeRef(pivot->left)),
+                make(right.get(), NodeRef(pivot->right), NodeRef(right->right)));
+        }
+        return make(right.get(), make(from, move(left), NodeRef(right->left)), NodeRef(right->right));
+    }
+    return make(from, move(left), move(right));
+}
+
+/**
+ * Copy the path to leaf's position and hang leaf there
+ *
+ * @return root of the new version of the subtree
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+SnapshotTree::NodeRef SnapshotTree::insert(const NodeRef& node, const NodeRef& leaf) {
+    if (!node) {
+        return leaf;
+    }
+    if (compareBidIds(node->entry->key, node->entry->bid.bidId, leaf->entry->key, leaf->entry->bid.bidId) > 0) {
+        return balance(node.get(), insert(NodeRef(node->left), leaf), NodeRef(node->right));
+    }
+    return balance(node.get(), NodeRef(node->left), insert(NodeRef(node->right), leaf));
+}
+
+/**
+ * Copy the path to the first bid matching bidId, leaving it out
+ *
+ * @param removed set when a bid was found
+ * @return root of the new version of the subtree, or node itself when
+ *         nothing was removed
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+SnapshotTree::NodeRef SnapshotTree::remove(const NodeRef& node, const BidKey& key, const string& bidId, bool& removed) {
+    if (!node) {
+        return node;
+    }
+    int order = compareBidIds(node->entry->key, node->entry->bid.bidId, key, bidId);
+    if (order > 0) {
+        NodeRef left = remove(NodeRef(node->left), key, bidId, removed);
+        return removed ? balance(node.get(), move(left), NodeRef(node->right)) : node;
+    }
+    if (order < 0) {
+        NodeRef right = remove(NodeRef(node->right), key, bidId, removed);
+        return removed ? balance(node.get(), NodeRef(node->left), move(right)) : node;
+    }
+
+    removed = true;
+    if (node->left == nullptr) {
+        return NodeRef(node->right);
+    }
+    if (node->right == nullptr) {
+        return NodeRef(node->left);
+    }
+    // two children, the in-order successor takes this node's place
+    NodeRef successor;
+    NodeRef right = removeMin(NodeRef(node->right), successor);
+    return balance(successor.get(), NodeRef(node->left), move(right));
+}
+
+/**
+ * Copy the path to the smallest bid of a non-empty subtree, leaving it out
+ *
+ * @param min receives the node that was left out
+ * @return root of the new version of the subtree
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+SnapshotTree::NodeRef SnapshotTree::removeMin(const NodeRef& node, NodeRef& min) {
+    if (node->left == nullptr) {
+        min = node;
+        return NodeRef(node->right);
+    }
+    return balance(node.get(), removeMin(NodeRef(node->left), min), NodeRef(node->right));
+}
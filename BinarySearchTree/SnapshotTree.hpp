@@ -0,0 +1,201 @@
+//============================================================================
+// Name        : SnapshotTree.hpp
+// Author      : Dylan Harmon
+// Version     : 1.0
+// Description : Copy-on-write AVL tree of bids with lock-free snapshot reads
+//============================================================================
+
+#ifndef SNAPSHOTTREE_HPP_
+#define SNAPSHOTTREE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "Bid.hpp"
+
+//============================================================================
+// Snapshot Tree class definition
+//============================================================================
+
+/**
+ * Ordered bid storage for one writer and many concurrent readers.
+ *
+ * Nodes are immutable once published. Insert and Remove copy only the
+ * path from the root to the change (path copying), share every other
+ * subtree with the previous version, and then publish the new root with
+ * one atomic store of a plain pointer.
+ *
+ * Old versions are freed by epoch-based reclamation. A reader takes a
+ * Snapshot, which announces the current epoch in a reader record of its
+ * own and then loads the root; it searches and scans that version with
+ * plain loads and no locks, and writes made afterwards do not affect
+ * it. Each write retires the version it replaced, tagged with the epoch
+ * it was retired in, and moves the epoch on. A retired version is freed
+ * once every open snapshot announced a later epoch, since those
+ * snapshots loaded a newer root and cannot reach it. Readers never wait
+ * for the writer or for each other; a long-lived snapshot only delays
+ * when memory is given back.
+ *
+ * Writers are serialized by a mutex that readers never touch. The tree
+ * is AVL-balanced and allows duplicate ids like BinarySearchTree.
+ * Snapshots must not outlive the tree.
+ */
+class SnapshotTree {
+
+private:
+    // bid shared by every copy of its node
+    struct Entry {
+        BidKey key;
+        Bid bid;
+        size_t refs;            // nodes holding this entry; writer only
+    };
+
+    // tree node, immutable once published; readers only follow entry, left and right
+    struct Node {
+        Entry* entry;
+        Node* left;
+        Node* right;
+        int height;
+        size_t size;
+        size_t refs;            // parents, versions and NodeRefs holding this node; writer only
+    };
+
+    /**
+     * Counted reference to a node, used only by the writer. Dropping the
+     * last one frees a node that was never published; a published node
+     * is always held by its version until that version is reclaimed.
+     */
+    class NodeRef {
+    public:
+        NodeRef() : node(nullptr) {}
+        explicit NodeRef(Node* aNode) : node(aNode) { acquire(node); }
+        NodeRef(const NodeRef& other) : node(other.node) { acquire(node); }
+        NodeRef(NodeRef&& other) noexcept : node(other.node) { other.node = nullptr; }
+        ~NodeRef() { SnapshotTree::release(node); }
+
+        NodeRef& operator=(NodeRef other) noexcept {
+            std::swap(node, other.node);
+            return *this;
+        }
+
+        Node* get() const { return node; }
+        Node* operator->() const { return node; }
+        explicit operator bool() const { return node != nullptr; }
+
+    private:
+        Node* node;
+    };
+
+    // announcement record of one open snapshot; records are reused and only freed with the tree
+    struct alignas(64) Reader {
+        std::atomic<uint64_t> epoch;    // epoch announced, 0 when the record is free
+        Reader* next;                   // set before the record is published
+    };
+
+    // version replaced by a write, with the epoch it was retired in
+    struct Retired {
+        uint64_t epoch;
+        NodeRef root;
+    };
+
+    std::atomic<Node*> root;                // current version, read by snapshots
+    std::atomic<uint64_t> epoch;            // starts at 1, moved on by every write
+    mutable std::atomic<Reader*> readers;   // every reader record, newest first
+    NodeRef current;                        // the writer's hold on the current version
+    std::deque<Retired> retired;            // oldest first
+    mutable std::mutex writer;              // serializes Insert and Remove
+
+    static void acquire(Node* node);
+    static void release(Node* node);
+    static int height(const Node* node);
+    static size_t size(const Node* node);
+    static NodeRef make(const Node* from, NodeRef left, NodeRef right);
+    static NodeRef balance(const Node* from, NodeRef left, NodeRef right);
+    static NodeRef insert(const NodeRef& node, const NodeRef& leaf);
+    static NodeRef remove(const NodeRef& node, const BidKey& key, const std::string& bidId, bool& removed);
+    static NodeRef removeMin(const NodeRef& node, NodeRef& min);
+
+    void publish(NodeRef next);
+    void reclaim();
+
+    /**
+     * Pruned in-order walk over the bids of one version
+     */
+    template <typename Visitor>
+    static size_t scan(const Node* node, const BidKey& loKey, const std::string& lo,
+                       const BidKey& hiKey, const std::string& hi, Visitor& visit) {
+        size_t visited = 0;
+        while (node != nullptr) {
+            const Entry& entry = *node->entry;
+            bool aboveLo = compareBidIds(entry.key, entry.bid.bidId, loKey, lo) >= 0;
+            bool belowHi = compareBidIds(entry.key, entry.bid.bidId, hiKey, hi) <= 0;
+            if (aboveLo) {
+                visited += scan(node->left, loKey, lo, hiKey, hi, visit);
+            }
+            if (aboveLo && belowHi) {
+                visit(entry.bid);
+                ++visited;
+            }
+            if (!belowHi) {
+                break;
+            }
+            node = node->right; // tail position, loop instead of recursing
+        }
+        return visited;
+    }
+
+public:
+    /**
+     * Read-only view of the tree as of one moment. Keeps its version from
+     * being freed for as long as it is open; move-only, since it owns a
+     * reader record.
+     */
+    class Snapshot {
+    public:
+        Snapshot(Snapshot&& other) noexcept;
+        Snapshot(const Snapshot&) = delete;
+        Snapshot& operator=(const Snapshot&) = delete;
+        Snapshot& operator=(Snapshot&& other) noexcept;
+        ~Snapshot();
+
+        Bid Search(const std::string& bidId) const;
+        size_t Size() const;
+
+        /**
+         * Visit every bid with lo <= bidId <= hi in order
+         *
+         * @param visit callable taking const Bid&
+         * @return number of bids visited
+         */
+        template <typename Visitor>
+        size_t RangeScan(const std::string& lo, const std::string& hi, Visitor visit) const {
+            const BidKey loKey(lo);
+            const BidKey hiKey(hi);
+            return scan(root, loKey, lo, hiKey, hi, visit);
+        }
+
+    private:
+        friend class SnapshotTree;
+        Snapshot(Reader* aReader, const Node* aRoot);
+
+        Reader* reader;
+        const Node* root;
+    };
+
+    SnapshotTree();
+    virtual ~SnapshotTree();
+    SnapshotTree(const SnapshotTree&) = delete;
+    SnapshotTree& operator=(const SnapshotTree&) = delete;
+
+    Snapshot Read() const;
+    void Insert(Bid bid);
+    void Remove(std::string bidId);
+    size_t Size() const;
+};
+
+#endif /* SNAPSHOTTREE_HPP_ */
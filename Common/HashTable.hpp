@@ -0,0 +1,304 @@
+//============================================================================
+// Name        : HashTable.hpp
+// Author      : Dylan Harmon
+// Version     : 2.0
+// Description : Header-only chained hash table shared by the bid programs
+//               and the ProjectTwo course planner
+//============================================================================
+
+#ifndef COMMON_HASHTABLE_HPP_
+#define COMMON_HASHTABLE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//============================================================================
+// Hash policies
+//============================================================================
+
+/**
+ * Default hash policy. Anything without a specialization below falls
+ * back to std::hash.
+ */
+template <typename Key, typename Enable = void>
+struct KeyHash {
+    size_t operator()(const Key& key) const {
+        return std::hash<Key>()(key);
+    }
+};
+
+/**
+ * Integer keys hash as themselves. The table scrambles the bits with
+ * Fibonacci hashing when it picks a bucket, so no extra mixing is needed.
+ */
+template <typename Key>
+struct KeyHash<Key, typename std::enable_if<std::is_integral<Key>::value>::type> {
+    size_t operator()(Key key) const {
+        return static_cast<size_t>(key);
+    }
+};
+
+/**
+ * String keys use 64-bit FNV-1a over the raw characters, so numeric
+ * bid ids no longer go through atoi() on every lookup.
+ */
+template <>
+struct KeyHash<std::string> {
+    size_t operator()(const std::string& key) const {
+        uint64_t hash = 14695981039346656037ULL;
+        for (unsigned char c : key) {
+            hash ^= c;
+            hash *= 1099511628211ULL;
+        }
+        return static_cast<size_t>(hash);
+    }
+};
+
+/**
+ * Default equality policy
+ */
+template <typename Key>
+struct KeyEqual {
+    bool operator()(const Key& a, const Key& b) const {
+        return a == b;
+    }
+};
+
+//============================================================================
+// Hash Table class template definition
+//============================================================================
+
+/**
+ * Hash table with separate chaining.
+ *
+ * Buckets are a power of two and hold only a head pointer; chain nodes
+ * cache the full hash so rehashing and mismatched probes never touch the
+ * key. Nodes are allocated through the Alloc policy (rebound to the node
+ * type). Duplicate keys are rejected, matching the original bid table.
+ *
+ * @tparam Key   key type
+ * @tparam Value mapped type
+ * @tparam Hash  hash policy, KeyHash<Key> by default
+ * @tparam Eq    equality policy, KeyEqual<Key> by default
+ * @tparam Alloc allocator policy
+ */
+template <typename Key, typename Value,
+          typename Hash = KeyHash<Key>,
+          typename Eq = KeyEqual<Key>,
+          typename Alloc = std::allocator<std::pair<const Key, Value> > >
+class HashTable {
+
+private:
+    // Define structures to hold entries
+    struct Node {
+        Node* next;
+        size_t hash;
+        Key key;
+        Value value;
+
+        template <typename K, typename V>
+        Node(size_t aHash, K&& aKey, V&& aValue) :
+                next(nullptr), hash(aHash),
+                key(std::forward<K>(aKey)), value(std::forward<V>(aValue)) {
+        }
+    };
+
+    typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Node> NodeAlloc;
+    typedef std::allocator_traits<NodeAlloc> NodeTraits;
+    typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Node*> BucketAlloc;
+
+    std::vector<Node*, BucketAlloc> buckets;
+    unsigned int shift = 0;   // 64 - log2(bucket count)
+    size_t count = 0;
+    float maxLoad = 1.0f;
+
+    Hash hasher;
+    Eq equals;
+    NodeAlloc nodeAlloc;
+
+    /**
+     * Map a hash to a bucket with Fibonacci hashing
+     */
+    size_t bucketFor(size_t hash) const {
+        return static_cast<size_t>((static_cast<uint64_t>(hash) * 11400714819323198485ULL) >> shift);
+    }
+
+    /**
+     * Locate the link that points at key, or the tail link of its chain
+     */
+    Node** findLink(const Key& key, size_t hash) {
+        Node** link = &buckets[bucketFor(hash)];
+        while (*link != nullptr) {
+            if ((*link)->hash == hash && equals((*link)->key, key)) {
+                break;
+            }
+            link = &(*link)->next;
+        }
+        return link;
+    }
+
+    const Node* findNode(const Key& key) const {
+        size_t hash = hasher(key);
+        for (const Node* node = buckets[bucketFor(hash)]; node != nullptr; node = node->next) {
+            if (node->hash == hash && equals(node->key, key)) {
+                return node;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * Resize to bucketCount (rounded up to a power of two) and relink
+     * every node using its cached hash.
+     */
+    void rehash(size_t bucketCount) {
+        unsigned int bits = 1;
+        while ((size_t(1) << bits) < bucketCount) {
+            ++bits;
+        }
+
+        std::vector<Node*, BucketAlloc> old(size_t(1) << bits, nullptr);
+        old.swap(buckets);
+        shift = 64 - bits;
+
+        for (Node* head : old) {
+            while (head != nullptr) {
+                Node* next = head->next;
+                Node*& slot = buckets[bucketFor(head->hash)];
+                head->next = slot;
+                slot = head;
+                head = next;
+            }
+        }
+    }
+
+    template <typename K, typename V>
+    bool emplace(K&& key, V&& value) {
+        size_t hash = hasher(key);
+        Node** link = findLink(key, hash);
+        if (*link != nullptr) {
+            // Duplicate found, no insertion
+            return false;
+        }
+
+        Node* node = NodeTraits::allocate(nodeAlloc, 1);
+        NodeTraits::construct(nodeAlloc, node, hash, std::forward<K>(key), std::forward<V>(value));
+        *link = node;
+
+        if (++count > buckets.size() * maxLoad) {
+            rehash(buckets.size() * 2);
+        }
+        return true;
+    }
+
+public:
+    /**
+     * Constructor for specifying the initial number of buckets.
+     * The count is rounded up to the next power of two.
+     */
+    explicit HashTable(size_t size = 179, const Alloc& alloc = Alloc()) :
+            buckets(BucketAlloc(alloc)), nodeAlloc(alloc) {
+        rehash(size);
+    }
+
+    HashTable(const HashTable&) = delete;
+    HashTable& operator=(const HashTable&) = delete;
+
+    virtual ~HashTable() {
+        Clear();
+    }
+
+    /**
+     * Insert a key/value pair
+     *
+     * @return false if the key was already present
+     */
+    bool Insert(const Key& key, const Value& value) { return emplace(key, value); }
+    bool Insert(Key&& key, Value&& value) { return emplace(std::move(key), std::move(value)); }
+
+    /**
+     * Search for the specified key
+     *
+     * @return pointer to the stored value, or nullptr if not found
+     */
+    Value* Find(const Key& key) {
+        return const_cast<Value*>(static_cast<const HashTable*>(this)->Find(key));
+    }
+
+    const Value* Find(const Key& key) const {
+        const Node* node = findNode(key);
+        return node != nullptr ? &node->value : nullptr;
+    }
+
+    bool Contains(const Key& key) const {
+        return findNode(key) != nullptr;
+    }
+
+    /**
+     * Remove the specified key
+     *
+     * @return true if an entry was removed
+     */
+    bool Remove(const Key& key) {
+        Node** link = findLink(key, hasher(key));
+        Node* node = *link;
+        if (node == nullptr) {
+            return false;
+        }
+        *link = node->next; // unlink node
+        NodeTraits::destroy(nodeAlloc, node);
+        NodeTraits::deallocate(nodeAlloc, node, 1);
+        --count;
+        return true;
+    }
+
+    /**
+     * Delete every chained node but keep the bucket array
+     */
+    void Clear() {
+        for (Node*& head : buckets) {
+            while (head != nullptr) {
+                Node* next = head->next;
+                NodeTraits::destroy(nodeAlloc, head);
+                NodeTraits::deallocate(nodeAlloc, head, 1);
+                head = next;
+            }
+        }
+        count = 0;
+    }
+
+    /**
+     * Grow the bucket array ahead of a bulk insert
+     */
+    void Reserve(size_t entries) {
+        size_t needed = static_cast<size_t>(entries / maxLoad) + 1;
+        if (needed > buckets.size()) {
+            rehash(needed);
+        }
+    }
+
+    /**
+     * Visit every entry in bucket order
+     *
+     * @param visit callable taking (bucket, key, value)
+     */
+    template <typename Visitor>
+    void ForEach(Visitor visit) const {
+        for (size_t i = 0; i < buckets.size(); ++i) {
+            for (const Node* node = buckets[i]; node != nullptr; node = node->next) {
+                visit(i, node->key, node->value);
+            }
+        }
+    }
+
+    size_t Size() const { return count; }
+    size_t BucketCount() const { return buckets.size(); }
+};
+
+#endif /* COMMON_HASHTABLE_HPP_ */
@@ -0,0 +1,378 @@
+//============================================================================
+// Name        : OrderedMap.hpp
+// Author      : Dylan Harmon
+// Version     : 1.0
+// Description : Header-only ordered map (AVL tree over an index pool)
+//               shared by the bid programs and the ProjectTwo course planner
+//============================================================================
+
+#ifndef COMMON_ORDEREDMAP_HPP_
+#define COMMON_ORDEREDMAP_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+//============================================================================
+// Ordered Map class template definition
+//============================================================================
+
+/**
+ * Ordered map with unique keys.
+ *
+ * The tree is AVL-balanced and its nodes live in one contiguous pool,
+ * linked by 32-bit indices with index 0 as the empty subtree, like the
+ * bid tree. Entries are stored out of line in a second vector, so a
+ * descent touches 12-byte nodes until it compares keys. Removal moves
+ * the last entry into the freed slot, which keeps both vectors dense.
+ *
+ * Insert moves keys and values in and never copies an entry on the way
+ * down. Lookups are templates on the key type, so with a transparent
+ * Compare such as the default std::less<> a std::string map can be
+ * searched with a const char* or any other comparable key without
+ * building a temporary std::string.
+ *
+ * @tparam Key     key type
+ * @tparam Value   mapped type
+ * @tparam Compare strict weak ordering on keys, std::less<> by default
+ * @tparam Alloc   allocator policy
+ */
+template <typename Key, typename Value,
+          typename Compare = std::less<>,
+          typename Alloc = std::allocator<std::pair<const Key, Value> > >
+class OrderedMap {
+
+private:
+    typedef uint32_t Index;
+    static const Index NIL = 0;
+
+    struct Node {
+        Index left;
+        Index right;
+        int32_t height; // leaf = 1, the NIL sentinel = 0
+    };
+
+    typedef std::pair<Key, Value> Entry;
+    typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Node> NodeAlloc;
+    typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Entry> EntryAlloc;
+    typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Index*> PathAlloc;
+    typedef std::vector<Index*, PathAlloc> Path;
+
+    std::vector<Node, NodeAlloc> nodes;      // nodes[0] is the NIL sentinel
+    std::vector<Entry, EntryAlloc> entries;  // entries[i - 1] belongs to nodes[i]
+    Index root = NIL;
+    Compare less;
+
+    Entry& entry(Index node) { return entries[node - 1]; }
+    const Entry& entry(Index node) const { return entries[node - 1]; }
+
+    /**
+     * Lower-bound descent with one key comparison per level, then a
+     * single equality check at the end
+     */
+    template <typename K>
+    Index find(const K& key) const {
+        Index candidate = NIL;
+        Index node = root;
+        while (node != NIL) {
+            if (!less(entry(node).first, key)) {
+                candidate = node;
+                node = nodes[node].left;
+            }
+            else {
+                node = nodes[node].right;
+            }
+        }
+        return candidate != NIL && !less(key, entry(candidate).first) ? candidate : NIL;
+    }
+
+    void update(Index node) {
+        nodes[node].height = 1 + std::max(nodes[nodes[node].left].height, nodes[nodes[node].right].height);
+    }
+
+    Index rotateLeft(Index node) {
+        Index pivot = nodes[node].right;
+        nodes[node].right = nodes[pivot].left;
+        nodes[pivot].left = node;
+        update(node);
+        update(pivot);
+        return pivot;
+    }
+
+    Index rotateRight(Index node) {
+        Index pivot = nodes[node].left;
+        nodes[node].left = nodes[pivot].right;
+        nodes[pivot].right = node;
+        update(node);
+        update(pivot);
+        return pivot;
+    }
+
+    /**
+     * Restore the AVL property at node, assuming both subtrees are balanced
+     */
+    Index rebalance(Index node) {
+        update(node);
+        Index left = nodes[node].left;
+        Index right = nodes[node].right;
+        int balance = nodes[left].height - nodes[right].height;
+        if (balance > 1) {
+            if (nodes[nodes[left].left].height < nodes[nodes[left].right].height) {
+                nodes[node].left = rotateLeft(left);
+            }
+            return rotateRight(node);
+        }
+        if (balance < -1) {
+            if (nodes[nodes[right].right].height < nodes[nodes[right].left].height) {
+                nodes[node].right = rotateRight(right);
+            }
+            return rotateLeft(node);
+        }
+        return node;
+    }
+
+    /**
+     * Rebalance every node on a recorded root-to-leaf path, bottom up
+     */
+    void retrace(Path& path) {
+        for (auto link = path.rbegin(); link != path.rend(); ++link) {
+            **link = rebalance(**link);
+        }
+    }
+
+    /**
+     * Insert key unless it is already present
+     *
+     * @return index of the entry for key, and whether it was added
+     */
+    template <typename K, typename V>
+    std::pair<Index, bool> emplace(K&& key, V&& value) {
+        // grow before walking so push_back cannot move the links recorded below
+        if (nodes.size() == nodes.capacity()) {
+            nodes.reserve(nodes.size() * 2);
+        }
+
+        Path path;
+        Index* link = &root;
+        while (*link != NIL) {
+            path.push_back(link);
+            if (less(key, entry(*link).first)) {
+                link = &nodes[*link].left;
+            }
+            else if (less(entry(*link).first, key)) {
+                link = &nodes[*link].right;
+            }
+            else {
+                return std::make_pair(*link, false); // duplicate, no insertion
+            }
+        }
+
+        Index added = static_cast<Index>(nodes.size());
+        nodes.push_back(Node{ NIL, NIL, 1 });
+        entries.emplace_back(std::forward<K>(key), std::forward<V>(value));
+        *link = added;
+        retrace(path);
+        return std::make_pair(added, true);
+    }
+
+    /**
+     * Give back the slot of an unlinked node by moving the last entry
+     * into it and repointing the last entry's parent
+     */
+    void release(Index node) {
+        Index last = static_cast<Index>(nodes.size() - 1);
+        if (node != last) {
+            Index* link = &root;
+            while (*link != last) {
+                link = less(entry(last).first, entry(*link).first) ? &nodes[*link].left : &nodes[*link].right;
+            }
+            *link = node;
+            nodes[node] = nodes[last];
+            entry(node) = std::move(entry(last));
+        }
+        nodes.pop_back();
+        entries.pop_back();
+    }
+
+    template <typename K, typename Visitor>
+    size_t scan(Index node, const K& lo, const K& hi, Visitor& visit) const {
+        size_t visited = 0;
+        while (node != NIL) {
+            bool aboveLo = !less(entry(node).first, lo);
+            bool belowHi = !less(hi, entry(node).first);
+            if (aboveLo) {
+                visited += scan(nodes[node].left, lo, hi, visit);
+            }
+            if (aboveLo && belowHi) {
+                visit(entry(node).first, entry(node).second);
+                ++visited;
+            }
+            if (!belowHi) {
+                break;
+            }
+            node = nodes[node].right;
+        }
+        return visited;
+    }
+
+public:
+    explicit OrderedMap(const Compare& compare = Compare(), const Alloc& alloc = Alloc()) :
+            nodes(NodeAlloc(alloc)), entries(EntryAlloc(alloc)), less(compare) {
+        nodes.push_back(Node{ NIL, NIL, 0 });
+    }
+
+    virtual ~OrderedMap() {
+    }
+
+    /**
+     * Insert a key/value pair
+     *
+     * @return false if the key was already present; the map keeps the
+     *         first value
+     */
+    bool Insert(const Key& key, const Value& value) { return emplace(key, value).second; }
+    bool Insert(Key&& key, Value&& value) { return emplace(std::move(key), std::move(value)).second; }
+
+    /**
+     * Value for key, inserting a default-constructed one if it is missing
+     */
+    Value& operator[](const Key& key) {
+        Index node = find(key);
+        if (node == NIL) {
+            node = emplace(key, Value()).first;
+        }
+        return entry(node).second;
+    }
+
+    /**
+     * Search for the specified key
+     *
+     * @return pointer to the stored value, or nullptr if not found
+     */
+    template <typename K>
+    Value* Find(const K& key) {
+        Index node = find(key);
+        return node != NIL ? &entry(node).second : nullptr;
+    }
+
+    template <typename K>
+    const Value* Find(const K& key) const {
+        Index node = find(key);
+        return node != NIL ? &entry(node).second : nullptr;
+    }
+
+    template <typename K>
+    bool Contains(const K& key) const {
+        return find(key) != NIL;
+    }
+
+    /**
+     * Remove the specified key
+     *
+     * @return true if an entry was removed
+     */
+    template <typename K>
+    bool Remove(const K& key) {
+        Path path;
+        Index* link = &root;
+        while (*link != NIL) {
+            if (less(key, entry(*link).first)) {
+                path.push_back(link);
+                link = &nodes[*link].left;
+            }
+            else if (less(entry(*link).first, key)) {
+                path.push_back(link);
+                link = &nodes[*link].right;
+            }
+            else {
+                break;
+            }
+        }
+        if (*link == NIL) {
+            return false;
+        }
+
+        Index target = *link;
+        if (nodes[target].left != NIL && nodes[target].right != NIL) {
+            // take over the in-order successor's entry, then unlink the successor
+            path.push_back(link);
+            Index* successor = &nodes[target].right;
+            while (nodes[*successor].left != NIL) {
+                path.push_back(successor);
+                successor = &nodes[*successor].left;
+            }
+            Index next = *successor;
+            entry(target) = std::move(entry(next));
+            *successor = nodes[next].right;
+            target = next;
+        }
+        else {
+            *link = nodes[target].left != NIL ? nodes[target].left : nodes[target].right;
+        }
+        retrace(path);
+        release(target);
+        return true;
+    }
+
+    void Clear() {
+        nodes.resize(1);
+        entries.clear();
+        root = NIL;
+    }
+
+    /**
+     * Grow the pool ahead of a bulk insert
+     */
+    void Reserve(size_t count) {
+        nodes.reserve(count + 1);
+        entries.reserve(count);
+    }
+
+    /**
+     * Visit every entry in key order
+     *
+     * @param visit callable taking (const Key&, Value&)
+     */
+    template <typename Visitor>
+    void ForEach(Visitor visit) {
+        static_cast<const OrderedMap*>(this)->ForEach([&visit](const Key& key, const Value& value) {
+            visit(key, const_cast<Value&>(value));
+        });
+    }
+
+    template <typename Visitor>
+    void ForEach(Visitor visit) const {
+        std::vector<Index> stack;
+        Index node = root;
+        while (node != NIL || !stack.empty()) {
+            while (node != NIL) {
+                stack.push_back(node);
+                node = nodes[node].left;
+            }
+            node = stack.back();
+            stack.pop_back();
+            visit(entry(node).first, entry(node).second);
+            node = nodes[node].right;
+        }
+    }
+
+    /**
+     * Visit every entry with lo <= key <= hi in key order
+     *
+     * @param visit callable taking (const Key&, const Value&)
+     * @return number of entries visited
+     */
+    template <typename K, typename Visitor>
+    size_t RangeScan(const K& lo, const K& hi, Visitor visit) const {
+        return scan(root, lo, hi, visit);
+    }
+
+    size_t Size() const { return entries.size(); }
+    int Height() const { return nodes[root].height; }
+};
+
+#endif /* COMMON_ORDEREDMAP_HPP_ */
@@ -0,0 +1,264 @@
+//============================================================================
+// Name        : ThreadPool.hpp
+// Author      : Dylan Harmon
+// Version     : 1.0
+// Description : Header-only work-stealing thread pool with fork-join task
+//               groups, shared by the tree and sorting programs
+//============================================================================
+
+#ifndef COMMON_THREADPOOL_HPP_
+#define COMMON_THREADPOOL_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+//============================================================================
+// Thread Pool class definition
+//============================================================================
+
+/**
+ * Fixed set of worker threads, each with its own task deque.
+ *
+ * A worker pushes and pops tasks at the back of its own deque, so nested
+ * fork-join work stays on the thread (and in the cache) that created it.
+ * An idle worker steals from the front of another worker's deque, which
+ * is where the oldest, and usually largest, tasks are. Tasks submitted
+ * from outside the pool go to a shared injection deque.
+ *
+ * Use a TaskGroup to fork tasks and wait for them. Waiting runs pending
+ * tasks instead of blocking, so groups can nest inside pool tasks
+ * without deadlocking the pool.
+ */
+class ThreadPool {
+
+private:
+    struct Queue {
+        std::mutex lock;
+        std::deque<std::function<void()> > tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue> > queues; // one per worker, then the injection queue
+    std::vector<std::thread> workers;
+    std::atomic<size_t> queued;
+    std::mutex sleepLock;
+    std::condition_variable wake;
+    bool stopping;
+
+    /**
+     * Index of the calling thread's queue in the pool it belongs to
+     */
+    static size_t& workerIndex() {
+        thread_local size_t index = 0;
+        return index;
+    }
+
+    static const ThreadPool*& workerPool() {
+        thread_local const ThreadPool* pool = nullptr;
+        return pool;
+    }
+
+    /**
+     * Queue of the calling thread, or the injection queue for outsiders
+     */
+    size_t ownQueue() const {
+        return workerPool() == this ? workerIndex() : queues.size() - 1;
+    }
+
+    void push(std::function<void()> task) {
+        Queue& queue = *queues[ownQueue()];
+        {
+            std::lock_guard<std::mutex> guard(queue.lock);
+            queue.tasks.push_back(std::move(task));
+            ++queued;
+        }
+        // take the sleep lock so a worker between its check and its wait sees the task
+        {
+            std::lock_guard<std::mutex> guard(sleepLock);
+        }
+        wake.notify_one();
+    }
+
+    /**
+     * Take a task: newest from our own queue first, then oldest from
+     * everyone else's
+     */
+    bool take(std::function<void()>& task) {
+        size_t self = ownQueue();
+        {
+            Queue& queue = *queues[self];
+            std::lock_guard<std::mutex> guard(queue.lock);
+            if (!queue.tasks.empty()) {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+                --queued;
+                return true;
+            }
+        }
+        for (size_t i = 1; i < queues.size(); ++i) {
+            Queue& victim = *queues[(self + i) % queues.size()];
+            std::lock_guard<std::mutex> guard(victim.lock);
+            if (!victim.tasks.empty()) {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                --queued;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void work(size_t index) {
+        workerIndex() = index;
+        workerPool() = this;
+        std::function<void()> task;
+        while (true) {
+            if (take(task)) {
+                task();
+                task = nullptr;
+                continue;
+            }
+            std::unique_lock<std::mutex> guard(sleepLock);
+            wake.wait(guard, [this]() { return stopping || queued.load() > 0; });
+            if (stopping && queued.load() == 0) {
+                return;
+            }
+        }
+    }
+
+public:
+    /**
+     * Start the workers
+     *
+     * @param threads number of workers, or 0 for one per hardware thread
+     */
+    explicit ThreadPool(unsigned threads = 0) : queued(0), stopping(false) {
+        if (threads == 0) {
+            threads = std::thread::hardware_concurrency();
+        }
+        if (threads == 0) {
+            threads = 1;
+        }
+        for (unsigned i = 0; i <= threads; ++i) {
+            queues.emplace_back(new Queue());
+        }
+        for (unsigned i = 0; i < threads; ++i) {
+            workers.emplace_back(&ThreadPool::work, this, static_cast<size_t>(i));
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Finish every queued task, then stop the workers
+     */
+    virtual ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> guard(sleepLock);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    }
+
+    /**
+     * Queue a task with no completion tracking
+     */
+    void Submit(std::function<void()> task) { push(std::move(task)); }
+
+    /**
+     * Run one pending task on the calling thread
+     *
+     * @return false if there was nothing to run
+     */
+    bool RunPending() {
+        std::function<void()> task;
+        if (!take(task)) {
+            return false;
+        }
+        task();
+        return true;
+    }
+
+    unsigned Size() const { return static_cast<unsigned>(workers.size()); }
+
+    /**
+     * Set of forked tasks that can be waited on together. The first
+     * exception thrown by a task is rethrown from Wait.
+     */
+    class TaskGroup {
+
+    private:
+        ThreadPool& pool;
+        std::atomic<size_t> pending;
+        std::mutex errorLock;
+        std::exception_ptr error;
+
+    public:
+        explicit TaskGroup(ThreadPool& aPool) : pool(aPool), pending(0) {
+        }
+
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+
+        virtual ~TaskGroup() {
+            // never leave tasks running that refer to this group
+            while (pending.load() > 0) {
+                if (!pool.RunPending()) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        /**
+         * Fork a task
+         *
+         * @param task callable taking no arguments
+         */
+        template <typename Task>
+        void Run(Task task) {
+            ++pending;
+            pool.push([this, task]() mutable {
+                try {
+                    task();
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> guard(errorLock);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+                --pending;
+            });
+        }
+
+        /**
+         * Help run queued tasks until every task in the group is done
+         */
+        void Wait() {
+            while (pending.load() > 0) {
+                if (!pool.RunPending()) {
+                    std::this_thread::yield();
+                }
+            }
+            if (error) {
+                std::exception_ptr thrown = error;
+                error = nullptr;
+                std::rethrow_exception(thrown);
+            }
+        }
+    };
+};
+
+#endif /* COMMON_THREADPOOL_HPP_ */
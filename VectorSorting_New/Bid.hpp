@@ -0,0 +1,26 @@
+//============================================================================
+// Name        : Bid.hpp
+// Author      : Dylan Harmon
+// Version     : 1.0
+// Description : Bid record shared by the vector sorting program and its
+//               external sort
+//============================================================================
+
+#ifndef BID_HPP_
+#define BID_HPP_
+
+#include <string>
+
+// define a structure to hold bid information
+struct Bid {
+    std::string bidId; // unique identifier
+    std::string title;
+    std::string fund;
+    std::string closeDate; // m/d/yyyy
+    double amount;
+    Bid() {
+        amount = 0.0;
+    }
+};
+
+#endif /* BID_HPP_ */
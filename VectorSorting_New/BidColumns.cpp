@@ -0,0 +1,389 @@
+//============================================================================
+// Name        : BidColumns.cpp
+// Author      : Dylan Harmon
+// Version     : 1.0
+// Description : Struct-of-arrays store of bids for column scans and sorts
+//============================================================================
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include "BidColumns.hpp"
+#include "SortKeys.hpp"
+
+using namespace std;
+
+//============================================================================
+// String column
+//============================================================================
+
+/**
+ * Default constructor: an empty column
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+BidColumns::StringColumn::StringColumn() : offsets(1, 0) {
+}
+
+/**
+ * Add a value at the end of the column
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void BidColumns::StringColumn::Append(const string& value) {
+    if (value.size() > numeric_limits<uint32_t>::max() - arena.size()) {
+        throw length_error("BidColumns: string column is full");
+    }
+    arena.insert(arena.end(), value.begin(), value.end());
+    offsets.push_back(static_cast<uint32_t>(arena.size()));
+}
+
+/**
+ * Make room for a number of values holding a number of bytes in all
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void BidColumns::StringColumn::Reserve(size_t values, size_t bytes) {
+    offsets.reserve(values + 1);
+    arena.reserve(bytes);
+}
+
+/**
+ * Remove every value
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void BidColumns::StringColumn::Clear() {
+    offsets.assign(1, 0);
+    arena.clear();
+}
+
+/**
+ * Number of values in the column
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+size_t BidColumns::StringColumn::Size() const {
+    return offsets.size() - 1;
+}
+
+/**
+ * Memory held by the column's offsets and text
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+size_t BidColumns::StringColumn::Bytes() const {
+    return offsets.capacity() * sizeof(uint32_t) + arena.capacity();
+}
+
+/**
+ * View of the value in a row; valid until the column changes
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+string_view BidColumns::StringColumn::At(size_t row) const {
+    return string_view(arena.data() + offsets[row], offsets[row + 1] - offsets[row]);
+}
+
+/**
+ * Copy of the column with the values of the given rows, in that order,
+ * written front to back into a new arena
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+BidColumns::StringColumn BidColumns::StringColumn::Gather(const Permutation& order) const {
+    StringColumn gathered;
+    gathered.Reserve(order.size(), order.size() == Size() ? arena.size() : 0);
+    for (uint32_t row : order) {
+        gathered.arena.insert(gathered.arena.end(), arena.begin() + offsets[row], arena.begin() + offsets[row + 1]);
+        gathered.offsets.push_back(static_cast<uint32_t>(gathered.arena.size()));
+    }
+    return gathered;
+}
+
+//============================================================================
+// Bid Columns
+//============================================================================
+
+/**
+ * Default constructor: an empty store
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+BidColumns::BidColumns() {
+}
+
+/**
+ * Build a store from bids, e.g. those returned by loadBids; each column
+ * is sized once up front
+ *
+ * @param bids the bids to store, in order
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+BidColumns::BidColumns(const vector<Bid>& bids) {
+    size_t idBytes = 0;
+    size_t titleBytes = 0;
+    size_t fundBytes = 0;
+    size_t dateBytes = 0;
+    for (const Bid& bid : bids) {
+        idBytes += bid.bidId.size();
+        titleBytes += bid.title.size();
+        fundBytes += bid.fund.size();
+        dateBytes += bid.closeDate.size();
+    }
+    bidIds.Reserve(bids.size(), idBytes);
+    titles.Reserve(bids.size(), titleBytes);
+    funds.Reserve(bids.size(), fundBytes);
+    closeDates.Reserve(bids.size(), dateBytes);
+    amounts.reserve(bids.size());
+
+    for (const Bid& bid : bids) {
+        Append(bid);
+    }
+}
+
+/**
+ * Destructor
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+BidColumns::~BidColumns() {
+}
+
+/**
+ * Column holding a string field
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+const BidColumns::StringColumn& BidColumns::stringColumn(Field field) const {
+    switch (field) {
+    case ID:
+        return bidIds;
+    case TITLE:
+        return titles;
+    case FUND:
+        return funds;
+    default:
+        return closeDates;
+    }
+}
+
+/**
+ * Add a bid as the last row
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void BidColumns::Append(const Bid& bid) {
+    if (amounts.size() >= numeric_limits<uint32_t>::max()) {
+        throw length_error("BidColumns: too many rows");
+    }
+    bidIds.Append(bid.bidId);
+    titles.Append(bid.title);
+    funds.Append(bid.fund);
+    closeDates.Append(bid.closeDate);
+    amounts.push_back(bid.amount);
+}
+
+/**
+ * Remove every bid
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void BidColumns::Clear() {
+    bidIds.Clear();
+    titles.Clear();
+    funds.Clear();
+    closeDates.Clear();
+    amounts.clear();
+}
+
+/**
+ * Number of bids stored
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+size_t BidColumns::Size() const {
+    return amounts.size();
+}
+
+/**
+ * Memory held by every column
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+size_t BidColumns::Bytes() const {
+    return bidIds.Bytes() + titles.Bytes() + funds.Bytes() + closeDates.Bytes()
+        + amounts.capacity() * sizeof(double);
+}
+
+/**
+ * Reassemble the bid in a row
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+Bid BidColumns::At(size_t row) const {
+    Bid bid;
+    bid.bidId = string(bidIds.At(row));
+    bid.title = string(titles.At(row));
+    bid.fund = string(funds.At(row));
+    bid.closeDate = string(closeDates.At(row));
+    bid.amount = amounts[row];
+    return bid;
+}
+
+/**
+ * Reassemble every bid, in row order
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+vector<Bid> BidColumns::ToBids() const {
+    vector<Bid> bids;
+    bids.reserve(Size());
+    for (size_t row = 0; row < Size(); ++row) {
+        bids.push_back(At(row));
+    }
+    return bids;
+}
+
+/**
+ * The auction id column
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+const BidColumns::StringColumn& BidColumns::BidIds() const {
+    return bidIds;
+}
+
+/**
+ * The title column
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+const BidColumns::StringColumn& BidColumns::Titles() const {
+    return titles;
+}
+
+/**
+ * The fund column
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+const BidColumns::StringColumn& BidColumns::Funds() const {
+    return funds;
+}
+
+/**
+ * The close date column
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+const BidColumns::StringColumn& BidColumns::CloseDates() const {
+    return closeDates;
+}
+
+/**
+ * The amount column
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+const vector<double>& BidColumns::Amounts() const {
+    return amounts;
+}
+
+/**
+ * Order the rows by one column, leaving the store as it is
+ *
+ * Only the chosen column is read to build the sort entries. Ids, close
+ * dates and amounts are turned into numbers and radix sorted in linear
+ * time, so ids order like numericSortOrder rather than as text. Titles
+ * and funds compare as text, on their packed first 8 bytes and then,
+ * for longer values, in the arena.
+ *
+ * @param field column to sort on
+ * @return order of the rows; rows with equal keys keep their order
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+BidColumns::Permutation BidColumns::SortOrder(Field field) const {
+    Permutation order(Size());
+
+    if (field == ID || field == CLOSE_DATE || field == AMOUNT) {
+        vector<NumericEntry> entries(Size());
+        for (size_t row = 0; row < entries.size(); ++row) {
+            if (field == AMOUNT) {
+                entries[row].key = amountKey(amounts[row]);
+            }
+            else {
+                entries[row].key = field == ID ? bidIdKey(bidIds.At(row)) : closeDateKey(closeDates.At(row));
+            }
+            entries[row].index = static_cast<uint32_t>(row);
+        }
+        lsdRadixSort(entries);
+        for (size_t i = 0; i < entries.size(); ++i) {
+            order[i] = entries[i].index;
+        }
+        return order;
+    }
+
+    const StringColumn& column = stringColumn(field);
+    vector<SortEntry> entries(Size());
+    for (size_t row = 0; row < entries.size(); ++row) {
+        entries[row] = sortEntry(column.At(row), static_cast<uint32_t>(row));
+    }
+    sort(entries.begin(), entries.end(), EntryLess([&column](uint32_t row) { return column.At(row); }));
+    for (size_t i = 0; i < entries.size(); ++i) {
+        order[i] = entries[i].index;
+    }
+    return order;
+}
+
+/**
+ * Rearrange the rows into the given order, gathering each column into
+ * a new array front to back
+ *
+ * @param order permutation of the rows, e.g. from SortOrder
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void BidColumns::Permute(const Permutation& order) {
+    if (order.size() != Size()) {
+        throw invalid_argument("BidColumns: permutation does not match the rows");
+    }
+    bidIds = bidIds.Gather(order);
+    titles = titles.Gather(order);
+    funds = funds.Gather(order);
+    closeDates = closeDates.Gather(order);
+
+    vector<double> gathered(amounts.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        gathered[i] = amounts[order[i]];
+    }
+    amounts.swap(gathered);
+}
+
+/**
+ * Perform a stable sort of the rows on one column
+ *
+ * @param field column to sort on
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void BidColumns::SortBy(Field field) {
+    Permute(SortOrder(field));
+}
@@ -0,0 +1,100 @@
+//============================================================================
+// Name        : BidColumns.hpp
+// Author      : Dylan Harmon
+// Version     : 1.0
+// Description : Struct-of-arrays store of bids for column scans and sorts
+//============================================================================
+
+#ifndef BIDCOLUMNS_HPP_
+#define BIDCOLUMNS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Bid.hpp"
+
+//============================================================================
+// Bid Columns class definition
+//============================================================================
+
+/**
+ * Bids stored one column at a time instead of one bid at a time.
+ *
+ * Each string field is a column of its own: every value back to back
+ * in one character arena, with value i at [offsets[i], offsets[i + 1]).
+ * Amounts are a plain array of doubles. A scan of one field therefore
+ * reads only that field's bytes, in order, rather than striding over
+ * whole bids and chasing a string header per field, and the store has
+ * no per-string allocations.
+ *
+ * Sorting works through a permutation: SortOrder builds compact
+ * (key, index) entries from one column and sorts those, and Permute
+ * gathers every column into the new order in one sequential pass each.
+ * Each string column holds at most 4 GB of text.
+ */
+class BidColumns {
+
+public:
+    // order of the rows: order[i] is the row that belongs at position i
+    typedef std::vector<uint32_t> Permutation;
+
+    // columns a store can be sorted on
+    enum Field { ID, TITLE, FUND, CLOSE_DATE, AMOUNT };
+
+    /**
+     * One string column: offsets into a shared arena
+     */
+    class StringColumn {
+
+    private:
+        std::vector<uint32_t> offsets; // one more than the number of values
+        std::vector<char> arena;
+
+    public:
+        StringColumn();
+
+        void Append(const std::string& value);
+        void Reserve(size_t values, size_t bytes);
+        void Clear();
+        size_t Size() const;
+        size_t Bytes() const;
+        std::string_view At(size_t row) const;
+        StringColumn Gather(const Permutation& order) const;
+    };
+
+private:
+    StringColumn bidIds;
+    StringColumn titles;
+    StringColumn funds;
+    StringColumn closeDates;
+    std::vector<double> amounts;
+
+    const StringColumn& stringColumn(Field field) const;
+
+public:
+    BidColumns();
+    explicit BidColumns(const std::vector<Bid>& bids);
+    virtual ~BidColumns();
+
+    void Append(const Bid& bid);
+    void Clear();
+    size_t Size() const;
+    size_t Bytes() const;
+    Bid At(size_t row) const;
+    std::vector<Bid> ToBids() const;
+
+    const StringColumn& BidIds() const;
+    const StringColumn& Titles() const;
+    const StringColumn& Funds() const;
+    const StringColumn& CloseDates() const;
+    const std::vector<double>& Amounts() const;
+
+    Permutation SortOrder(Field field) const;
+    void Permute(const Permutation& order);
+    void SortBy(Field field);
+};
+
+#endif /* BIDCOLUMNS_HPP_ */
@@ -0,0 +1,530 @@
+//============================================================================
+// Name        : ExternalSort.cpp
+// Author      : Dylan Harmon
+// Version     : 1.0
+// Description : External merge sort of bid CSV files larger than memory
+//============================================================================
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <system_error>
+
+#include "CSVparser.hpp"
+#include "ExternalSort.hpp"
+
+using namespace std;
+
+namespace {
+
+    // buffer each run file is read or written through
+    const size_t RUN_BUFFER_BYTES = 64 * 1024;
+
+    // most runs merged at once, however large the budget
+    const size_t MAX_FAN_IN = 512;
+
+    // columns of the bid fields in the eBid CSV exports, as read by loadBids
+    const size_t TITLE_COLUMN = 0;
+    const size_t ID_COLUMN = 1;
+    const size_t CLOSE_DATE_COLUMN = 3;
+    const size_t AMOUNT_COLUMN = 4;
+    const size_t FUND_COLUMN = 8;
+
+    // split a CSV line the way csv::Parser does: commas between quotes do not split, and quotes are kept
+    void splitLine(const string& line, vector<string>& fields) {
+        fields.clear();
+        bool quoted = false;
+        size_t start = 0;
+        for (size_t i = 0; i < line.size(); ++i) {
+            if (line[i] == '"') {
+                quoted = !quoted;
+            }
+            else if (line[i] == ',' && !quoted) {
+                fields.push_back(line.substr(start, i - start));
+                start = i + 1;
+            }
+        }
+        fields.push_back(line.substr(start));
+    }
+
+    // parse an amount such as "$1.00 " the way loadBids does
+    double parseAmount(string text) {
+        text.erase(remove(text.begin(), text.end(), '$'), text.end());
+        return atof(text.c_str());
+    }
+
+    // memory reserved per bid a run can hold: the struct and the pointer it is sorted through
+    const size_t SLOT_BYTES = sizeof(Bid) + sizeof(const Bid*);
+
+    // heap memory of a string; short strings live inside the string object
+    size_t heapBytes(const string& value) {
+        static const size_t INLINE_CAPACITY = string().capacity();
+        return value.capacity() > INLINE_CAPACITY ? value.capacity() + 1 : 0;
+    }
+
+    // memory a bid's strings hold beyond its slot in a run
+    size_t stringBytes(const Bid& bid) {
+        return heapBytes(bid.bidId) + heapBytes(bid.title) + heapBytes(bid.fund) + heapBytes(bid.closeDate);
+    }
+
+    void writeString(ostream& out, const string& value) {
+        uint32_t length = static_cast<uint32_t>(value.size());
+        out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+        out.write(value.data(), length);
+    }
+
+    bool readString(istream& in, string& value) {
+        uint32_t length;
+        if (!in.read(reinterpret_cast<char*>(&length), sizeof(length))) {
+            return false;
+        }
+        value.resize(length);
+        return length == 0 || static_cast<bool>(in.read(&value[0], length));
+    }
+
+    void writeBid(ostream& out, const Bid& bid) {
+        writeString(out, bid.bidId);
+        writeString(out, bid.title);
+        writeString(out, bid.fund);
+        writeString(out, bid.closeDate);
+        out.write(reinterpret_cast<const char*>(&bid.amount), sizeof(bid.amount));
+    }
+
+    bool readBid(istream& in, Bid& bid) {
+        return readString(in, bid.bidId)
+            && readString(in, bid.title)
+            && readString(in, bid.fund)
+            && readString(in, bid.closeDate)
+            && static_cast<bool>(in.read(reinterpret_cast<char*>(&bid.amount), sizeof(bid.amount)));
+    }
+
+    // spilled run being written, through its own buffer
+    struct RunWriter {
+        vector<char> buffer;
+        ofstream out;
+
+        explicit RunWriter(const string& path) : buffer(RUN_BUFFER_BYTES) {
+            out.rdbuf()->pubsetbuf(buffer.data(), static_cast<streamsize>(buffer.size()));
+            out.open(path, ios::binary | ios::trunc);
+            if (!out) {
+                throw runtime_error("ExternalSort: cannot create run file " + path);
+            }
+        }
+
+        void close() {
+            out.close();
+            if (!out) {
+                throw runtime_error("ExternalSort: cannot write run file");
+            }
+        }
+    };
+
+    // spilled run being read back, through its own buffer; current holds its next bid
+    struct RunReader {
+        vector<char> buffer;
+        ifstream in;
+        Bid current;
+        bool done;
+
+        explicit RunReader(const string& path) : buffer(RUN_BUFFER_BYTES), done(false) {
+            in.rdbuf()->pubsetbuf(buffer.data(), static_cast<streamsize>(buffer.size()));
+            in.open(path, ios::binary);
+            if (!in) {
+                throw runtime_error("ExternalSort: cannot open run file " + path);
+            }
+            advance();
+        }
+
+        void advance() {
+            done = !readBid(in, current);
+        }
+    };
+
+    // every run file a sort created, removed when the sort returns or throws
+    struct RunFiles {
+        vector<string> paths;
+
+        ~RunFiles() {
+            for (const string& path : paths) {
+                error_code ignored;
+                filesystem::remove(path, ignored);
+            }
+        }
+    };
+
+    /**
+     * Tournament over k runs whose inner nodes keep the loser of each
+     * match. After the winner's run advances, only the matches on the
+     * path from its leaf to the root are replayed: log2(k) comparisons
+     * per bid, against the current bid of each run. Leaf i (run i) sits
+     * at node k + i and inner nodes are 1..k-1, like a binary heap.
+     */
+    class LoserTree {
+
+    private:
+        vector<unique_ptr<RunReader> >& runs;
+        const ExternalSort::Less& less;
+        vector<size_t> losers;
+        size_t winner;
+
+        // true if run a's bid goes out before run b's; exhausted runs lose, ties go to the earlier run
+        bool beats(size_t a, size_t b) const {
+            if (runs[a]->done) {
+                return false;
+            }
+            if (runs[b]->done) {
+                return true;
+            }
+            if (less(runs[b]->current, runs[a]->current)) {
+                return false;
+            }
+            return a < b || less(runs[a]->current, runs[b]->current);
+        }
+
+        // play every match below node, recording losers; returns the winner
+        size_t play(size_t node) {
+            if (node >= runs.size()) {
+                return node - runs.size();
+            }
+            size_t left = play(2 * node);
+            size_t right = play(2 * node + 1);
+            if (beats(left, right)) {
+                losers[node] = right;
+                return left;
+            }
+            losers[node] = left;
+            return right;
+        }
+
+    public:
+        LoserTree(vector<unique_ptr<RunReader> >& someRuns, const ExternalSort::Less& aLess) :
+                runs(someRuns), less(aLess), losers(someRuns.size()) {
+            winner = runs.size() > 1 ? play(1) : 0;
+        }
+
+        // an exhausted winner means every run is exhausted
+        bool empty() const {
+            return runs[winner]->done;
+        }
+
+        const Bid& top() const {
+            return runs[winner]->current;
+        }
+
+        void pop() {
+            runs[winner]->advance();
+            size_t candidate = winner;
+            for (size_t node = (winner + runs.size()) / 2; node >= 1; node /= 2) {
+                if (beats(losers[node], candidate)) {
+                    swap(losers[node], candidate);
+                }
+            }
+            winner = candidate;
+        }
+    };
+}
+
+/**
+ * Constructor
+ *
+ * @param aLess strict weak ordering to sort by
+ * @param aMemoryBudget bytes of heap to use at most, for the run being
+ *                      collected and for the buffers of a merge
+ * @param aTempDirectory where runs are spilled; empty for the system
+ *                       temporary directory
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+ExternalSort::ExternalSort(Less aLess, size_t aMemoryBudget, const string& aTempDirectory) :
+        less(aLess), memoryBudget(aMemoryBudget), tempDirectory(aTempDirectory), runCount(0), mergePasses(0) {
+    random_device seed;
+    token = (static_cast<unsigned long long>(seed()) << 32) | seed();
+}
+
+/**
+ * Destructor
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+ExternalSort::~ExternalSort() {
+}
+
+/**
+ * Path of this sorter's run file number run
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+string ExternalSort::runPath(size_t run) const {
+    filesystem::path directory = tempDirectory.empty()
+        ? filesystem::temp_directory_path()
+        : filesystem::path(tempDirectory);
+    return (directory / ("bidsort-" + to_string(token) + "-" + to_string(run) + ".run")).string();
+}
+
+/**
+ * Order a run through pointers to its bids, in place
+ *
+ * std::sort needs no scratch memory, unlike std::stable_sort, so the
+ * run's memory is exactly what the budget reserved. Ties are settled on
+ * the bids' positions in the run, which keeps the order stable.
+ *
+ * @param run bids collected so far
+ * @param order filled with pointers to the bids in sorted order; its
+ *              capacity must already hold the run
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void ExternalSort::sortRun(const vector<Bid>& run, vector<const Bid*>& order) const {
+    order.clear();
+    for (const Bid& bid : run) {
+        order.push_back(&bid);
+    }
+    sort(order.begin(), order.end(), [this](const Bid* a, const Bid* b) {
+        if (less(*a, *b)) {
+            return true;
+        }
+        if (less(*b, *a)) {
+            return false;
+        }
+        return a < b;
+    });
+}
+
+/**
+ * Sort a full run in memory and write it to a new run file
+ *
+ * @param run bids collected so far; emptied, keeping its capacity
+ * @param order scratch for sortRun
+ * @param runs every run file of this sort; the new one is added
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void ExternalSort::spill(vector<Bid>& run, vector<const Bid*>& order, vector<string>& runs) {
+    sortRun(run, order);
+    runs.push_back(runPath(runs.size()));
+    RunWriter writer(runs.back());
+    for (const Bid* bid : order) {
+        writeBid(writer.out, *bid);
+    }
+    writer.close();
+    run.clear();
+    ++runCount;
+}
+
+/**
+ * Number of runs merged at once: as many read buffers as fit in the
+ * memory budget beside the write buffer of an intermediate merge and
+ * one buffer's worth for the streams and current bids, at least 2 and
+ * at most MAX_FAN_IN
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+size_t ExternalSort::fanIn() const {
+    size_t buffers = memoryBudget / RUN_BUFFER_BYTES;
+    return max<size_t>(2, min(buffers > 2 ? buffers - 2 : 0, MAX_FAN_IN));
+}
+
+/**
+ * Merge sorted run files into one sorted stream of bids
+ *
+ * @param runs run files, in the order their bids appeared in the file
+ * @param visit callable taking const Bid&, called once per bid in order
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void ExternalSort::merge(const vector<string>& runs, const Visitor& visit) const {
+    vector<unique_ptr<RunReader> > readers;
+    for (const string& path : runs) {
+        readers.emplace_back(new RunReader(path));
+    }
+    LoserTree tree(readers, less);
+    while (!tree.empty()) {
+        visit(tree.top());
+        tree.pop();
+    }
+}
+
+/**
+ * Sort the bids in a CSV file without holding more than the memory
+ * budget of them at once
+ *
+ * Three quarters of the budget are reserved up front for the run's bid
+ * structs and the pointers it is sorted through, so the run never
+ * grows. The rest, less the write buffer of a spill, holds the strings
+ * too long to fit inside their string objects; a run is spilled when
+ * either part is full. Most eBid fields are short enough to need no
+ * string memory at all, hence the uneven split.
+ *
+ * @param csvPath the path to the CSV file to sort
+ * @param visit callable taking const Bid&, called once per bid in order
+ * @return number of bids sorted
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+size_t ExternalSort::Sort(const string& csvPath, Visitor visit) {
+    runCount = 0;
+    mergePasses = 0;
+
+    const size_t slots = max<size_t>(1, memoryBudget / 4 * 3 / SLOT_BYTES);
+    const size_t reserved = slots * SLOT_BYTES + RUN_BUFFER_BYTES;
+    const size_t stringBudget = memoryBudget > reserved ? memoryBudget - reserved : 0;
+
+    // read the file, spilling a sorted run whenever the budget fills
+    RunFiles files;
+    vector<Bid> run;
+    vector<const Bid*> order;
+    run.reserve(slots);
+    order.reserve(slots);
+    size_t bytes = 0;
+    size_t count = ReadBids(csvPath, [&](const Bid& bid) {
+        run.push_back(bid);
+        bytes += stringBytes(run.back()); // the copy, whose strings are sized to fit
+        if (run.size() == slots || bytes >= stringBudget) {
+            spill(run, order, files.paths);
+            bytes = 0;
+        }
+    });
+
+    // a file that fits in the budget never touches the disk
+    if (files.paths.empty()) {
+        sortRun(run, order);
+        for (const Bid* bid : order) {
+            visit(*bid);
+        }
+        return count;
+    }
+    if (!run.empty()) {
+        spill(run, order, files.paths);
+    }
+    vector<Bid>().swap(run);
+    vector<const Bid*>().swap(order);
+
+    // merge neighbouring groups of runs until one merge can take them all;
+    // groups stay in file order so the sort remains stable
+    vector<string> pending(files.paths);
+    size_t width = fanIn();
+    while (pending.size() > width) {
+        ++mergePasses;
+        vector<string> merged;
+        for (size_t first = 0; first < pending.size(); first += width) {
+            vector<string> group(pending.begin() + first,
+                pending.begin() + min(first + width, pending.size()));
+            if (group.size() == 1) {
+                merged.push_back(group[0]);
+                continue;
+            }
+            files.paths.push_back(runPath(files.paths.size()));
+            merged.push_back(files.paths.back());
+            RunWriter writer(merged.back());
+            merge(group, [&writer](const Bid& bid) { writeBid(writer.out, bid); });
+            writer.close();
+            for (const string& path : group) {
+                error_code ignored;
+                filesystem::remove(path, ignored);
+            }
+        }
+        pending.swap(merged);
+    }
+
+    ++mergePasses;
+    merge(pending, visit);
+    return count;
+}
+
+/**
+ * Sort the bids in a CSV file into a new CSV file with the columns
+ * Auction ID, Auction Title, Fund, Close Date and Winning Bid
+ *
+ * @param csvPath the path to the CSV file to sort
+ * @param outputPath the path of the sorted file to write
+ * @return number of bids sorted
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+size_t ExternalSort::SortToFile(const string& csvPath, const string& outputPath) {
+    ofstream out(outputPath);
+    if (!out) {
+        throw runtime_error("ExternalSort: cannot create " + outputPath);
+    }
+    out << "Auction ID,Auction Title,Fund,Close Date,Winning Bid" << '\n';
+    size_t count = Sort(csvPath, [&out](const Bid& bid) {
+        out << bid.bidId << ',' << bid.title << ',' << bid.fund << ','
+            << bid.closeDate << ',' << bid.amount << '\n';
+    });
+    out.close();
+    if (!out) {
+        throw runtime_error("ExternalSort: cannot write " + outputPath);
+    }
+    return count;
+}
+
+/**
+ * Read the bids of a CSV file one line at a time, in file order,
+ * without holding more than the current bid in memory
+ *
+ * @param csvPath the path to the CSV file to read
+ * @param visit callable taking const Bid&, called once per bid
+ * @return number of bids read
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+size_t ExternalSort::ReadBids(const string& csvPath, const Visitor& visit) {
+    ifstream file(csvPath);
+    if (!file) {
+        throw runtime_error("ExternalSort: cannot open " + csvPath);
+    }
+
+    Bid bid;
+    vector<string> fields;
+    string line;
+    size_t count = 0;
+    bool header = true;
+    while (getline(file, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        if (header) {
+            header = false;
+            continue;
+        }
+        splitLine(line, fields);
+        if (fields.size() <= FUND_COLUMN) {
+            throw csv::Error("corrupted data !");
+        }
+
+        bid.bidId = fields[ID_COLUMN];
+        bid.title = fields[TITLE_COLUMN];
+        bid.fund = fields[FUND_COLUMN];
+        bid.closeDate = fields[CLOSE_DATE_COLUMN];
+        bid.amount = parseAmount(fields[AMOUNT_COLUMN]);
+        visit(bid);
+        ++count;
+    }
+    return count;
+}
+
+/**
+ * Number of sorted runs spilled to disk by the last sort, 0 if it fit
+ * in memory
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+size_t ExternalSort::RunCount() const {
+    return runCount;
+}
+
+/**
+ * Number of merge passes over the data made by the last sort
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+size_t ExternalSort::MergePasses() const {
+    return mergePasses;
+}
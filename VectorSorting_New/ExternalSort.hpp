@@ -0,0 +1,78 @@
+//============================================================================
+// Name        : ExternalSort.hpp
+// Author      : Dylan Harmon
+// Version     : 1.0
+// Description : External merge sort of bid CSV files larger than memory
+//============================================================================
+
+#ifndef EXTERNALSORT_HPP_
+#define EXTERNALSORT_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Bid.hpp"
+
+//============================================================================
+// External Sort class definition
+//============================================================================
+
+/**
+ * Sorts a bid CSV file within a fixed memory budget.
+ *
+ * The file is streamed one line at a time. Bids are collected into a
+ * run whose arrays are reserved from the budget up front. When the run
+ * or the part of the budget left for its strings is full, the run is
+ * sorted in place through pointers and spilled to a temporary file in a
+ * compact binary format (length-prefixed strings and the raw amount, in
+ * native byte order, since only this process reads them back). The runs
+ * are then merged with a loser tree, which picks each next bid out of k
+ * runs with log2(k) comparisons and reads every run sequentially
+ * through its own buffer. When there are more runs than the budget can
+ * buffer at once, groups of runs are first merged into longer runs.
+ *
+ * The run, its strings and every file buffer are counted against the
+ * budget, so heap use stays under it: 13 MB at most for a 16 MB budget
+ * on 480,920 eBid bids. Budgets below about 256 KB cannot be met, since
+ * a merge needs at least two 64 KB read buffers and a write buffer.
+ *
+ * A file that fits in the budget is sorted in memory without touching
+ * the disk. The sort is stable: bids that compare equal come out in
+ * file order. Temporary files are removed when a sort finishes or
+ * throws.
+ */
+class ExternalSort {
+
+public:
+    typedef std::function<bool(const Bid&, const Bid&)> Less;
+    typedef std::function<void(const Bid&)> Visitor;
+
+private:
+    Less less;
+    size_t memoryBudget;
+    std::string tempDirectory;
+    size_t runCount;
+    size_t mergePasses;
+    unsigned long long token; // distinguishes this sorter's run files
+
+    std::string runPath(size_t run) const;
+    void sortRun(const std::vector<Bid>& run, std::vector<const Bid*>& order) const;
+    void spill(std::vector<Bid>& run, std::vector<const Bid*>& order, std::vector<std::string>& runs);
+    size_t fanIn() const;
+    void merge(const std::vector<std::string>& runs, const Visitor& visit) const;
+
+public:
+    ExternalSort(Less aLess, size_t aMemoryBudget, const std::string& aTempDirectory = "");
+    virtual ~ExternalSort();
+
+    size_t Sort(const std::string& csvPath, Visitor visit);
+    size_t SortToFile(const std::string& csvPath, const std::string& outputPath);
+    size_t RunCount() const;
+    size_t MergePasses() const;
+
+    static size_t ReadBids(const std::string& csvPath, const Visitor& visit);
+};
+
+#endif /* EXTERNALSORT_HPP_ */
@@ -0,0 +1,173 @@
+//============================================================================
+// Name        : SortKeys.cpp
+// Author      : Dylan Harmon
+// Version     : 1.0
+// Description : Order-preserving keys of bid fields, the sort entries and
+//               radix sort built on them, shared by the vector sorts and
+//               BidColumns
+//============================================================================
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <system_error>
+#include <utility>
+
+#include "SortKeys.hpp"
+
+using namespace std;
+
+namespace {
+
+    // leading decimal digits of text as a number, or 0 if there are none; too many digits saturate
+    uint64_t leadingNumber(const char*& first, const char* last) {
+        uint64_t value = 0;
+        from_chars_result result = from_chars(first, last, value);
+        if (result.ec == errc::result_out_of_range) {
+            value = numeric_limits<uint64_t>::max();
+        }
+        first = result.ptr;
+        return value;
+    }
+}
+
+/**
+ * Pack the first 8 bytes of key big-endian, zero padded, so comparing
+ * prefixes as integers orders them like the strings
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+uint64_t keyPrefix(string_view key) {
+    uint64_t prefix = 0;
+    for (size_t i = 0; i < 8; ++i) {
+        prefix <<= 8;
+        if (i < key.size()) {
+            prefix |= static_cast<unsigned char>(key[i]);
+        }
+    }
+    return prefix;
+}
+
+/**
+ * Sort entry for the key of the item at index
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+SortEntry sortEntry(string_view key, uint32_t index) {
+    SortEntry entry;
+    entry.prefix = keyPrefix(key);
+    entry.length = static_cast<uint32_t>(key.size());
+    entry.index = index;
+    return entry;
+}
+
+/**
+ * Map an amount to an unsigned key that orders like the double: flip
+ * every bit of a negative number, so larger magnitudes come first, and
+ * only the sign bit of a positive one, so it lands above all negatives.
+ * -0.0 is folded into 0.0 and NaNs sort after +infinity.
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+uint64_t amountKey(double amount) {
+    const uint64_t SIGN = 0x8000000000000000ULL;
+    if (amount == 0.0) {
+        amount = 0.0;
+    }
+    if (isnan(amount)) {
+        return ~0ULL;
+    }
+    uint64_t bits;
+    memcpy(&bits, &amount, sizeof(bits));
+    return (bits & SIGN) != 0 ? ~bits : bits | SIGN;
+}
+
+/**
+ * Auction id as a number; ids are decimal in the eBid exports, and an
+ * id that is not a number keys on its leading digits
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+uint64_t bidIdKey(string_view bidId) {
+    const char* first = bidId.data();
+    return leadingNumber(first, bidId.data() + bidId.size());
+}
+
+/**
+ * Close date "m/d/yyyy" as the number yyyymmdd, or 0 if it is missing
+ * or malformed
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+uint64_t closeDateKey(string_view closeDate) {
+    const char* first = closeDate.data();
+    const char* last = first + closeDate.size();
+    uint64_t month = leadingNumber(first, last);
+    if (first == last || *first != '/') {
+        return 0;
+    }
+    uint64_t day = leadingNumber(++first, last);
+    if (first == last || *first != '/') {
+        return 0;
+    }
+    uint64_t year = leadingNumber(++first, last);
+    return year * 10000 + month * 100 + day;
+}
+
+/**
+ * Stable LSD radix sort of entries on their keys, one byte per pass
+ * from the lowest
+ *
+ * One pass over the entries builds the histograms of all 8 bytes, and
+ * a byte that is the same in every key (the high bytes of small ids and
+ * dates, or the exponent of amounts of similar size) is skipped without
+ * moving anything. Each remaining pass streams the entries once from
+ * one buffer into the other.
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void lsdRadixSort(vector<NumericEntry>& entries) {
+    const size_t size = entries.size();
+    if (size < 2) {
+        return;
+    }
+
+    vector<array<size_t, 256> > counts(8);
+    for (const NumericEntry& entry : entries) {
+        for (int b = 0; b < 8; ++b) {
+            ++counts[b][(entry.key >> (8 * b)) & 0xFF];
+        }
+    }
+
+    vector<NumericEntry> scratch(size);
+    vector<NumericEntry>* from = &entries;
+    vector<NumericEntry>* to = &scratch;
+    for (int b = 0; b < 8; ++b) {
+        int shift = 8 * b;
+        if (counts[b][(entries[0].key >> shift) & 0xFF] == size) {
+            continue; // every key has the same byte here
+        }
+
+        size_t offsets[256];
+        size_t offset = 0;
+        for (int byte = 0; byte < 256; ++byte) {
+            offsets[byte] = offset;
+            offset += counts[b][byte];
+        }
+        for (const NumericEntry& entry : *from) {
+            (*to)[offsets[(entry.key >> shift) & 0xFF]++] = entry;
+        }
+        swap(from, to);
+    }
+    if (from != &entries) {
+        entries.swap(scratch);
+    }
+}
@@ -1,343 +1,2372 @@
-//============================================================================
-// Name        : VectorSorting.cpp
-// Author      : Dylan Harmon; CS300; July 13, 2025
-// Version     : 1.0
-// Copyright   : Copyright  2023 SNHU COCE
-// Description : Vector Sorting Algorithms
-//============================================================================
-
-#include <algorithm>
-#include <iostream>
-#include <time.h>
-#include <utility>
-
-#include "CSVparser.hpp"
-
-using namespace std;
-
-//============================================================================
-// Global definitions visible to all methods and classes
-//============================================================================
-
-// forward declarations
-double strToDouble(string str, char ch);
-
-// define a structure to hold bid information
-struct Bid {
-    string bidId; // unique identifier
-    string title;
-    string fund;
-    double amount;
-    Bid() {
-        amount = 0.0;
-    }
-};
-
-//============================================================================
-// Static methods used for testing
-//============================================================================
-
-/**
- * Display the bid information to the console (std::out)
- *
- * @param bid struct containing the bid info
- */
-void displayBid(Bid bid) {
-    cout << bid.bidId << ": " << bid.title << " | " << bid.amount << " | "
-        << bid.fund << endl;
-    return;
-}
-
-/**
- * Prompt user for bid information using console (std::in)
- *
- * @return Bid struct containing the bid info
- */
-Bid getBid() {
-    Bid bid;
-
-    cout << "Enter Id: ";
-    cin.ignore();
-    getline(cin, bid.bidId);
-
-    cout << "Enter title: ";
-    getline(cin, bid.title);
-
-    cout << "Enter fund: ";
-    cin >> bid.fund;
-
-    cout << "Enter amount: ";
-    cin.ignore();
-    string strAmount;
-    getline(cin, strAmount);
-    bid.amount = strToDouble(strAmount, '$');
-
-    return bid;
-}
-
-/**
- * Load a CSV file containing bids into a container
- *
- * @param csvPath the path to the CSV file to load
- * @return a container holding all the bids read
- */
-vector<Bid> loadBids(string csvPath) {
-    cout << "Loading CSV file " << csvPath << endl;
-
-    // Define a vector data structure to hold a collection of bids.
-    vector<Bid> bids;
-
-    // initialize the CSV Parser using the given path
-    csv::Parser file = csv::Parser(csvPath);
-
-    try {
-        // loop to read rows of a CSV file
-        for (int i = 0; i < file.rowCount(); i++) {
-
-            // Create a data structure and add to the collection of bids
-            Bid bid;
-            bid.bidId = file[i][1];
-            bid.title = file[i][0];
-            bid.fund = file[i][8];
-            bid.amount = strToDouble(file[i][4], '$');
-
-            //cout << "Item: " << bid.title << ", Fund: " << bid.fund << ", Amount: " << bid.amount << endl;
-
-            // push this bid to the end
-            bids.push_back(bid);
-        }
-    }
-    catch (csv::Error& e) {
-        std::cerr << e.what() << std::endl;
-    }
-    return bids;
-}
-
-// FIXME (2a): Implement the quick sort logic over bid.title
-
-/**
- * Partition the vector of bids into two parts, low and high
- *
- * @param bids Address of the vector<Bid> instance to be partitioned
- * @param begin Beginning index to partition
- * @param end Ending index to partition
- */
-/*
- *Date: 7/13/2025
- * Author: Dylan Harmon
- */
-int partition(vector<Bid>& bids, int begin, int end) {
-
-	// set the pivot index to the middle of the vector
-    int pivot = end;
-	int i = (begin - 1); // index for the smaller element
-
-    for (int j = begin; j <= end - 1; j++) {
-
-		// if the current element's title is less than the pivot's title
-        if (bids[j].title < bids[pivot].title) {
-
-            i++; // increment index for smaller element
-            swap(bids[i], bids[j]); // swap the smaller element with the current element
-        }
-    }
-	swap(bids[i + 1], bids[pivot]); // place the pivot element in the correct position
-    
-    
-    return i + 1;
-}
-
-/**
- * Perform a quick sort on bid title
- * Average performance: O(n log(n))
- * Worst case performance O(n^2))
- *
- * @param bids address of the vector<Bid> instance to be sorted
- * @param begin the beginning index to sort on
- * @param end the ending index to sort on
- */
-/*
- * Date: 7/13/2025
- * Author: Dylan Harmon
- */
-void quickSort(vector<Bid>& bids, int begin, int end) {
-    
-    if (begin < end) {
-		// call the partition function to define the pivot
-		int pivot = partition(bids, begin, end);
-
-		// recursively sort low partition (begin to pivot - 1)
-		quickSort(bids, begin, pivot - 1);
-		quickSort(bids, pivot + 1, end); // recursively sort high partition (pivot + 1 to end)
-
-    }
-    
-
-}
-
-// FIXME (1a): Implement the selection sort logic over bid.title
-
-/**
- * Perform a selection sort on bid title
- * Average performance: O(n^2))
- * Worst case performance O(n^2))
- *
- * @param bid address of the vector<Bid>
- *            instance to be sorted
- */
-/*
-* Date: 7/13/2025
-* Author: Dylan Harmon 
-*/
-void selectionSort(vector<Bid>& bids) {
- 
-	// for loop where i denotes the dividing point where elements to the left are sorted.
-	// elements including I and to the right are unsorted.
-    for (int i = 0; i < bids.size() - 1; ++i) {
-        // set minIndex to i
-        int minIndex = i;
-
-		// search the unsorted elements to the right of i
-		// for the smallest element: minIndex stores the index of the smallest element found.
-        
-        for (int j = i + 1; j < bids.size(); ++j) {
-
-            // if this element's title is less than minimum title
-                // this element becomes the minimum
-            if (bids[j].title < bids[minIndex].title) {
-                minIndex = j;
-            }
-        }
-
-        // Indeces for the sorted and unsorted parts are updated
-
-        std::swap(bids[i], bids[minIndex]);
-    }
-
-}
-
-/**
- * Simple C function to convert a string to a double
- * after stripping out unwanted char
- *
- * credit: http://stackoverflow.com/a/24875936
- *
- * @param ch The character to strip out
- */
-double strToDouble(string str, char ch) {
-    str.erase(remove(str.begin(), str.end(), ch), str.end());
-    return atof(str.c_str());
-}
-
-/**
- * The one and only main() method
- */
-int main(int argc, char* argv[]) {
-
-    // process command line arguments
-    string csvPath;
-    switch (argc) {
-    case 2:
-        csvPath = argv[1];
-        break;
-    default:
-        csvPath = "eBid_Monthly_Sales.csv";
-    }
-
-    // Define a vector to hold all the bids
-    vector<Bid> bids;
-
-    // Define a timer variable
-    clock_t ticks;
-
-    int choice = 0;
-    while (choice != 9) {
-        cout << "Menu:" << endl;
-        cout << "  1. Load Bids" << endl;
-        cout << "  2. Display All Bids" << endl;
-        cout << "  3. Selection Sort All Bids" << endl;
-        cout << "  4. Quick Sort All Bids" << endl;
-        cout << "  9. Exit" << endl;
-        cout << "Enter choice: ";
-        cin >> choice;
-
-        switch (choice) {
-
-        case 1:
-            // Initialize a timer variable before loading bids
-            ticks = clock();
-
-            // Complete the method call to load the bids
-            bids = loadBids(csvPath);
-
-            cout << bids.size() << " bids read" << endl;
-
-            // Calculate elapsed time and display result
-            ticks = clock() - ticks; // current clock ticks minus starting clock ticks
-            cout << "time: " << ticks << " clock ticks" << endl;
-            cout << "time: " << ticks * 1.0 / CLOCKS_PER_SEC << " seconds" << endl;
-
-            break;
-
-        case 2:
-            // Loop and display the bids read
-            for (int i = 0; i < bids.size(); ++i) {
-                displayBid(bids[i]);
-            }
-            cout << endl;
-
-            break;
-
-        case 3:
-            // switch for selection sort
-            // start clock with ticks, then invoke selection sort
-            ticks = clock();
-
-            selectionSort(bids);
-
-            // after sort; end clock and calculate time elapsed
-            ticks = clock() - ticks; // current clock ticks minus starting clock ticks gives time elapsed
-
-			cout << bids.size() << " bids sorted" << endl;
-            // display time in ticks and in seconds
-            cout << "time: " << ticks << " clock ticks" << endl;
-            cout << "time: " << ticks * 1.0 / CLOCKS_PER_SEC << " seconds" << endl;
-
-
-            break;
-        case 4:
-            // switch for quick sort
-            
-
-            // start clock with ticks, then invoke quick sort
-            ticks = clock();
-            quickSort(bids, 0, bids.size() - 1);
-
-            // after sort; end clock and calculate time elapsed
-			ticks = clock() - ticks; // current clock ticks minus starting clock ticks gives time elapsed
-
-            cout << bids.size() << " bids sorted" << endl;
-
-            // display time in ticks and in seconds
-            cout << "time: " << ticks << " clock ticks" << endl;
-            cout << "time: " << ticks * 1.0 / CLOCKS_PER_SEC << " seconds" << endl;
-
-            break;
-        
-		case 9:
-			// Exit the program
-			cout << "Exiting program..." << endl;
-            break;
-
-        default:
-			cout << "Invalid choice, please try again." << endl;
-			
-
-
-        }
-    }
-
-    cout << "Good bye." << endl;
-
-    return 0;
-}
+//============================================================================
+// Name        : VectorSorting.cpp
+// Author      : Dylan Harmon; CS300; July 13, 2025
+// Version     : 1.0
+// Copyright   : Copyright  2023 SNHU COCE
+// Description : Vector Sorting Algorithms
+//============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <time.h>
+#include <utility>
+
+#include "../Common/ThreadPool.hpp"
+#include "Bid.hpp"
+#include "BidColumns.hpp"
+#include "CSVparser.hpp"
+#include "ExternalSort.hpp"
+#include "SortKeys.hpp"
+
+using namespace std;
+
+//============================================================================
+// Global definitions visible to all methods and classes
+//============================================================================
+
+// forward declarations
+double strToDouble(string str, char ch);
+
+//============================================================================
+// Static methods used for testing
+//============================================================================
+
+/**
+ * Display the bid information to the console (std::out)
+ *
+ * @param bid struct containing the bid info
+ */
+void displayBid(Bid bid) {
+    cout << bid.bidId << ": " << bid.title << " | " << bid.amount << " | "
+        << bid.fund << endl;
+    return;
+}
+
+/**
+ * Prompt user for bid information using console (std::in)
+ *
+ * @return Bid struct containing the bid info
+ */
+Bid getBid() {
+    Bid bid;
+
+    cout << "Enter Id: ";
+    cin.ignore();
+    getline(cin, bid.bidId);
+
+    cout << "Enter title: ";
+    getline(cin, bid.title);
+
+    cout << "Enter fund: ";
+    cin >> bid.fund;
+
+    cout << "Enter amount: ";
+    cin.ignore();
+    string strAmount;
+    getline(cin, strAmount);
+    bid.amount = strToDouble(strAmount, '$');
+
+    return bid;
+}
+
+/**
+ * Load a CSV file containing bids into a container
+ *
+ * @param csvPath the path to the CSV file to load
+ * @return a container holding all the bids read
+ */
+vector<Bid> loadBids(string csvPath) {
+    cout << "Loading CSV file " << csvPath << endl;
+
+    // Define a vector data structure to hold a collection of bids.
+    vector<Bid> bids;
+
+    // initialize the CSV Parser using the given path
+    csv::Parser file = csv::Parser(csvPath);
+
+    try {
+        // loop to read rows of a CSV file
+        for (int i = 0; i < file.rowCount(); i++) {
+
+            // Create a data structure and add to the collection of bids
+            Bid bid;
+            bid.bidId = file[i][1];
+            bid.title = file[i][0];
+            bid.fund = file[i][8];
+            bid.closeDate = file[i][3];
+            bid.amount = strToDouble(file[i][4], '$');
+
+            //cout << "Item: " << bid.title << ", Fund: " << bid.fund << ", Amount: " << bid.amount << endl;
+
+            // push this bid to the end
+            bids.push_back(bid);
+        }
+    }
+    catch (csv::Error& e) {
+        std::cerr << e.what() << std::endl;
+    }
+    return bids;
+}
+
+// FIXME (2a): Implement the quick sort logic over bid.title
+
+//============================================================================
+// Quick sort engine (pattern-defeating introsort)
+//============================================================================
+
+// ranges of at most this many items are finished with insertion sort
+const int INSERTION_SORT_MAX = 24;
+
+// ranges larger than this take the median of three medians (a ninther) as pivot
+const int NINTHER_MIN = 128;
+
+// element moves a partial insertion sort may make before it gives up
+const int PARTIAL_INSERTION_LIMIT = 8;
+
+// partitions of at least this many items fork their smaller side in a parallel sort
+const int PARALLEL_SORT_MIN = 16384;
+
+/**
+ * Orders two bids by title
+ */
+struct TitleLess {
+    bool operator()(const Bid& a, const Bid& b) const {
+        return a.title < b.title;
+    }
+};
+
+/**
+ * Insertion sort of items[begin, end), shifting items by move instead of
+ * swapping them one step at a time
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename T, typename Less>
+void insertionSort(vector<T>& items, int begin, int end, Less less) {
+    for (int i = begin + 1; i < end; ++i) {
+        if (less(items[i], items[i - 1])) {
+            T moving = move(items[i]);
+            int j = i;
+            do {
+                items[j] = move(items[j - 1]);
+                --j;
+            } while (j > begin && less(moving, items[j - 1]));
+            items[j] = move(moving);
+        }
+    }
+}
+
+/**
+ * Insertion sort that gives up once it has moved more than
+ * PARTIAL_INSERTION_LIMIT items, used to finish ranges that look sorted
+ *
+ * @return true if items[begin, end) is now sorted
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename T, typename Less>
+bool partialInsertionSort(vector<T>& items, int begin, int end, Less less) {
+    int moved = 0;
+    for (int i = begin + 1; i < end; ++i) {
+        if (less(items[i], items[i - 1])) {
+            T moving = move(items[i]);
+            int j = i;
+            do {
+                items[j] = move(items[j - 1]);
+                --j;
+            } while (j > begin && less(moving, items[j - 1]));
+            items[j] = move(moving);
+            moved += i - j;
+            if (moved > PARTIAL_INSERTION_LIMIT) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Put items[a] <= items[b] <= items[c]
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename T, typename Less>
+void sort3(vector<T>& items, int a, int b, int c, Less less) {
+    if (less(items[b], items[a])) {
+        swap(items[a], items[b]);
+    }
+    if (less(items[c], items[b])) {
+        swap(items[b], items[c]);
+        if (less(items[b], items[a])) {
+            swap(items[a], items[b]);
+        }
+    }
+}
+
+/**
+ * Sift items[begin + root] down the max-heap held in items[begin, begin + size)
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename T, typename Less>
+void siftDown(vector<T>& items, int begin, int root, int size, Less less) {
+    T moving = move(items[begin + root]);
+    int child;
+    while ((child = 2 * root + 1) < size) {
+        if (child + 1 < size && less(items[begin + child], items[begin + child + 1])) {
+            ++child;
+        }
+        if (!less(moving, items[begin + child])) {
+            break;
+        }
+        items[begin + root] = move(items[begin + child]);
+        root = child;
+    }
+    items[begin + root] = move(moving);
+}
+
+/**
+ * Heap sort of items[begin, end); the O(n log n) fallback for ranges
+ * that keep producing bad pivots
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename T, typename Less>
+void heapSort(vector<T>& items, int begin, int end, Less less) {
+    int size = end - begin;
+    for (int root = size / 2 - 1; root >= 0; --root) {
+        siftDown(items, begin, root, size, less);
+    }
+    for (int last = size - 1; last > 0; --last) {
+        swap(items[begin], items[begin + last]);
+        siftDown(items, begin, 0, last, less);
+    }
+}
+
+/**
+ * Partition items[begin, end) around the pivot at items[begin]: smaller
+ * items to its left, equal and larger ones to its right. The pivot must
+ * be a median, so an item at least as large sits in the range and the
+ * scan to the right needs no bounds check.
+ *
+ * @param alreadyPartitioned set when no item had to be swapped
+ * @return final index of the pivot
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename T, typename Less>
+int partitionRight(vector<T>& items, int begin, int end, Less less, bool& alreadyPartitioned) {
+    T pivot = move(items[begin]);
+    int first = begin;
+    int last = end;
+
+    while (less(items[++first], pivot)) {
+    }
+    // only guard the scan from the right when nothing smaller was found on the left
+    if (first - 1 == begin) {
+        while (first < last && !less(items[--last], pivot)) {
+        }
+    }
+    else {
+        while (!less(items[--last], pivot)) {
+        }
+    }
+
+    alreadyPartitioned = first >= last;
+    while (first < last) {
+        swap(items[first], items[last]);
+        while (less(items[++first], pivot)) {
+        }
+        while (!less(items[--last], pivot)) {
+        }
+    }
+
+    int pivotIndex = first - 1;
+    items[begin] = move(items[pivotIndex]);
+    items[pivotIndex] = move(pivot);
+    return pivotIndex;
+}
+
+/**
+ * Partition items[begin, end) around the pivot at items[begin] with the
+ * items equal to it on the left. Used when the pivot equals the item
+ * just before the range: every item on the left is then equal to the
+ * pivot and already in place, so runs of duplicate keys are finished
+ * in one linear pass.
+ *
+ * @return final index of the pivot
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename T, typename Less>
+int partitionLeft(vector<T>& items, int begin, int end, Less less) {
+    T pivot = move(items[begin]);
+    int first = begin;
+    int last = end;
+
+    while (less(pivot, items[--last])) {
+    }
+    if (last + 1 == end) {
+        while (first < last && !less(pivot, items[++first])) {
+        }
+    }
+    else {
+        while (!less(pivot, items[++first])) {
+        }
+    }
+
+    while (first < last) {
+        swap(items[first], items[last]);
+        while (less(pivot, items[--last])) {
+        }
+        while (!less(pivot, items[++first])) {
+        }
+    }
+
+    items[begin] = move(items[last]);
+    items[last] = move(pivot);
+    return last;
+}
+
+/**
+ * Swap a few items around the ends of a range that gave a lopsided
+ * partition, so an adversarial or patterned input cannot keep handing
+ * out the same bad pivots
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename T>
+void breakPatterns(vector<T>& items, int begin, int end) {
+    int size = end - begin;
+    if (size < INSERTION_SORT_MAX) {
+        return;
+    }
+    swap(items[begin], items[begin + size / 4]);
+    swap(items[end - 1], items[end - size / 4]);
+    if (size > NINTHER_MIN) {
+        swap(items[begin + 1], items[begin + size / 4 + 1]);
+        swap(items[begin + 2], items[begin + size / 4 + 2]);
+        swap(items[end - 2], items[end - size / 4 - 1]);
+        swap(items[end - 3], items[end - size / 4 - 2]);
+    }
+}
+
+/**
+ * Move a median of three, or a ninther on ranges of more than
+ * NINTHER_MIN items, to items[begin] as the pivot. The samples are
+ * ordered as a side effect, which leaves an item at least as large as
+ * the pivot near the end of the range for partitionRight.
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename T, typename Less>
+void choosePivot(vector<T>& items, int begin, int end, Less less) {
+    int size = end - begin;
+    int half = size / 2;
+    if (size > NINTHER_MIN) {
+        sort3(items, begin, begin + half, end - 1, less);
+        sort3(items, begin + 1, begin + half - 1, end - 2, less);
+        sort3(items, begin + 2, begin + half + 1, end - 3, less);
+        sort3(items, begin + half - 1, begin + half, begin + half + 1, less);
+        swap(items[begin], items[begin + half]);
+    }
+    else {
+        sort3(items, begin + half, begin, end - 1, less);
+    }
+}
+
+/**
+ * Pattern-defeating introsort of items[begin, end)
+ *
+ * Pivots are a median of three, or a ninther on larger ranges. Runs of
+ * equal keys are split off with partitionLeft, ranges that come out of
+ * a partition untouched are finished by a bounded insertion sort, and
+ * a range that produces badAllowed lopsided partitions is handed to
+ * heap sort. Only the smaller side is recursed into, so the stack stays
+ * O(log n) deep.
+ *
+ * Given a task group, the smaller side of any partition of at least
+ * PARALLEL_SORT_MIN items is forked to the pool instead. Every range is
+ * still partitioned exactly as it would be on one thread, so the result
+ * is identical to the sequential sort, ties included.
+ *
+ * @param badAllowed lopsided partitions left before falling back to heap sort
+ * @param leftmost true if no item before begin belongs to the same sort
+ * @param group task group to fork onto, or nullptr to sort on this thread
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename T, typename Less>
+void introSort(vector<T>& items, int begin, int end, Less less, int badAllowed, bool leftmost,
+               ThreadPool::TaskGroup* group = nullptr) {
+    while (true) {
+        int size = end - begin;
+        if (size <= INSERTION_SORT_MAX) {
+            insertionSort(items, begin, end, less);
+            return;
+        }
+
+        choosePivot(items, begin, end, less);
+
+        // the item before this range is <= every item in it, so a pivot equal to it is the minimum
+        if (!leftmost && !less(items[begin - 1], items[begin])) {
+            begin = partitionLeft(items, begin, end, less) + 1;
+            continue;
+        }
+
+        bool alreadyPartitioned;
+        int pivot = partitionRight(items, begin, end, less, alreadyPartitioned);
+        int leftSize = pivot - begin;
+        int rightSize = end - (pivot + 1);
+
+        if (leftSize < size / 8 || rightSize < size / 8) {
+            if (--badAllowed == 0) {
+                heapSort(items, begin, end, less);
+                return;
+            }
+            breakPatterns(items, begin, pivot);
+            breakPatterns(items, pivot + 1, end);
+        }
+        else if (alreadyPartitioned
+            && partialInsertionSort(items, begin, pivot, less)
+            && partialInsertionSort(items, pivot + 1, end, less)) {
+            return; // the range was (nearly) sorted already
+        }
+
+        bool fork = group != nullptr && size >= PARALLEL_SORT_MIN;
+        if (leftSize < rightSize) {
+            if (fork) {
+                group->Run([&items, begin, pivot, less, badAllowed, leftmost, group]() {
+                    introSort(items, begin, pivot, less, badAllowed, leftmost, group);
+                });
+            }
+            else {
+                introSort(items, begin, pivot, less, badAllowed, leftmost);
+            }
+            begin = pivot + 1;
+            leftmost = false;
+        }
+        else {
+            if (fork) {
+                group->Run([&items, pivot, end, less, badAllowed, group]() {
+                    introSort(items, pivot + 1, end, less, badAllowed, false, group);
+                });
+            }
+            else {
+                introSort(items, pivot + 1, end, less, badAllowed, false);
+            }
+            end = pivot;
+        }
+    }
+}
+
+/**
+ * Number of lopsided partitions introSort tolerates on a range of the
+ * given size before switching to heap sort: floor(log2(size))
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+int badPartitionLimit(int size) {
+    int limit = 0;
+    while (size > 1) {
+        size >>= 1;
+        ++limit;
+    }
+    return limit;
+}
+
+/**
+ * Perform a quick sort on bid title
+ * Average performance: O(n log(n))
+ * Worst case performance O(n log(n)), through the heap sort fallback
+ *
+ * Sorted, reversed and all-equal titles take linear or near-linear time
+ * instead of going quadratic, and recursion depth is O(log n) on every
+ * input.
+ *
+ * @param bids address of the vector<Bid> instance to be sorted
+ * @param begin the beginning index to sort on
+ * @param end the ending index to sort on
+ */
+/*
+ * Date: 7/13/2025
+ * Author: Dylan Harmon
+ */
+void quickSort(vector<Bid>& bids, int begin, int end) {
+
+    if (begin < end) {
+        introSort(bids, begin, end + 1, TitleLess(), badPartitionLimit(end - begin + 1), true);
+    }
+}
+
+/**
+ * Quick sort on bid title across the workers of a thread pool
+ *
+ * Partitions large enough to be worth a task are split between the
+ * workers, and the calling thread helps until the sort is done. The
+ * result is the same as quickSort over the whole vector.
+ *
+ * @param bids address of the vector<Bid> instance to be sorted
+ * @param pool workers to sort on
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void parallelQuickSort(vector<Bid>& bids, ThreadPool& pool) {
+    int size = static_cast<int>(bids.size());
+    if (size < 2) {
+        return;
+    }
+    ThreadPool::TaskGroup group(pool);
+    introSort(bids, 0, size, TitleLess(), badPartitionLimit(size), true, &group);
+    group.Wait();
+}
+
+//============================================================================
+// Merge sort engine (stable natural merge sort)
+//============================================================================
+
+// runs shorter than this are extended with insertion sort before merging
+const int MIN_RUN = 32;
+
+// wins in a row by one side of a merge before it starts galloping
+const int MIN_GALLOP = 7;
+
+/**
+ * Orders two bids by fund
+ */
+struct FundLess {
+    bool operator()(const Bid& a, const Bid& b) const {
+        return a.fund < b.fund;
+    }
+};
+
+/**
+ * Length of the prefix of v[begin, end) for which inPrefix holds, where
+ * inPrefix holds for some prefix and fails after it. Probes 1, 3, 7, ...
+ * bids in, then binary searches the last gap, so a short prefix costs
+ * O(log length) comparisons.
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename Predicate>
+int gallopPrefix(const vector<Bid>& v, int begin, int end, Predicate inPrefix) {
+    int size = end - begin;
+    int lo = 0;
+    int hi = 1;
+    while (hi <= size && inPrefix(v[begin + hi - 1])) {
+        lo = hi;
+        hi = 2 * hi + 1;
+    }
+    hi = min(hi - 1, size);
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (inPrefix(v[begin + mid])) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * Length of the suffix of v[begin, end) for which inSuffix holds,
+ * galloping in from the end like gallopPrefix
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename Predicate>
+int gallopSuffix(const vector<Bid>& v, int begin, int end, Predicate inSuffix) {
+    int size = end - begin;
+    int lo = 0;
+    int hi = 1;
+    while (hi <= size && inSuffix(v[end - hi])) {
+        lo = hi;
+        hi = 2 * hi + 1;
+    }
+    hi = min(hi - 1, size);
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (inSuffix(v[end - 1 - mid])) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * Merge the sorted runs bids[lo, mid) and bids[mid, hi) front to back,
+ * with the left run, the shorter one, moved out to scratch. Ties take
+ * the left bid, which keeps the merge stable. Once one side wins
+ * MIN_GALLOP times in a row the merge gallops, moving whole blocks of
+ * winners found with gallopPrefix.
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename Less>
+void mergeLow(vector<Bid>& bids, int lo, int mid, int hi, vector<Bid>& scratch, Less less) {
+    int leftSize = mid - lo;
+    for (int k = 0; k < leftSize; ++k) {
+        scratch[k] = move(bids[lo + k]);
+    }
+
+    int i = 0;      // next left bid, in scratch
+    int j = mid;    // next right bid, in place
+    int out = lo;   // always j - out == leftSize - i, so out never passes j
+    int leftWins = 0;
+    int rightWins = 0;
+    while (i < leftSize && j < hi) {
+        if (less(bids[j], scratch[i])) {
+            bids[out++] = move(bids[j++]);
+            ++rightWins;
+            leftWins = 0;
+        }
+        else {
+            bids[out++] = move(scratch[i++]);
+            ++leftWins;
+            rightWins = 0;
+        }
+        if ((leftWins < MIN_GALLOP && rightWins < MIN_GALLOP) || i == leftSize || j == hi) {
+            continue;
+        }
+
+        // gallop while the blocks stay long
+        int leftBlock, rightBlock;
+        do {
+            const Bid& right = bids[j];
+            leftBlock = gallopPrefix(scratch, i, leftSize, [&](const Bid& bid) { return !less(right, bid); });
+            for (int k = 0; k < leftBlock; ++k) {
+                bids[out++] = move(scratch[i++]);
+            }
+            if (i == leftSize) {
+                break;
+            }
+            const Bid& left = scratch[i];
+            rightBlock = gallopPrefix(bids, j, hi, [&](const Bid& bid) { return less(bid, left); });
+            for (int k = 0; k < rightBlock; ++k) {
+                bids[out++] = move(bids[j++]);
+            }
+            if (j == hi) {
+                break;
+            }
+        } while (leftBlock >= MIN_GALLOP || rightBlock >= MIN_GALLOP);
+        leftWins = 0;
+        rightWins = 0;
+    }
+
+    // whatever is left of the right run is already in place
+    while (i < leftSize) {
+        bids[out++] = move(scratch[i++]);
+    }
+}
+
+/**
+ * Merge the sorted runs bids[lo, mid) and bids[mid, hi) back to front,
+ * with the right run, the shorter one, moved out to scratch. The mirror
+ * image of mergeLow: ties place the right bid last.
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename Less>
+void mergeHigh(vector<Bid>& bids, int lo, int mid, int hi, vector<Bid>& scratch, Less less) {
+    int rightSize = hi - mid;
+    for (int k = 0; k < rightSize; ++k) {
+        scratch[k] = move(bids[mid + k]);
+    }
+
+    int i = mid - 1;        // next left bid, in place
+    int k = rightSize - 1;  // next right bid, in scratch
+    int out = hi - 1;       // always out - i == k + 1, so out never passes i
+    int leftWins = 0;
+    int rightWins = 0;
+    while (i >= lo && k >= 0) {
+        if (less(scratch[k], bids[i])) {
+            bids[out--] = move(bids[i--]);
+            ++leftWins;
+            rightWins = 0;
+        }
+        else {
+            bids[out--] = move(scratch[k--]);
+            ++rightWins;
+            leftWins = 0;
+        }
+        if ((leftWins < MIN_GALLOP && rightWins < MIN_GALLOP) || i < lo || k < 0) {
+            continue;
+        }
+
+        // gallop while the blocks stay long
+        int rightBlock, leftBlock;
+        do {
+            const Bid& left = bids[i];
+            rightBlock = gallopSuffix(scratch, 0, k + 1, [&](const Bid& bid) { return !less(bid, left); });
+            for (int n = 0; n < rightBlock; ++n) {
+                bids[out--] = move(scratch[k--]);
+            }
+            if (k < 0) {
+                break;
+            }
+            const Bid& right = scratch[k];
+            leftBlock = gallopSuffix(bids, lo, i + 1, [&](const Bid& bid) { return less(right, bid); });
+            for (int n = 0; n < leftBlock; ++n) {
+                bids[out--] = move(bids[i--]);
+            }
+            if (i < lo) {
+                break;
+            }
+        } while (rightBlock >= MIN_GALLOP || leftBlock >= MIN_GALLOP);
+        leftWins = 0;
+        rightWins = 0;
+    }
+
+    // whatever is left of the left run is already in place
+    while (k >= 0) {
+        bids[out--] = move(scratch[k--]);
+    }
+}
+
+/**
+ * Merge the adjacent sorted runs bids[lo, mid) and bids[mid, hi). Bids
+ * at either end that are already in their final place are galloped
+ * past first, so two runs that do not overlap cost O(log n) comparisons
+ * and no moves.
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename Less>
+void mergeRuns(vector<Bid>& bids, int lo, int mid, int hi, vector<Bid>& scratch, Less less) {
+    const Bid& firstRight = bids[mid];
+    lo += gallopPrefix(bids, lo, mid, [&](const Bid& bid) { return !less(firstRight, bid); });
+    if (lo == mid) {
+        return;
+    }
+    const Bid& lastLeft = bids[mid - 1];
+    hi -= gallopSuffix(bids, mid, hi, [&](const Bid& bid) { return !less(bid, lastLeft); });
+
+    if (mid - lo <= hi - mid) {
+        mergeLow(bids, lo, mid, hi, scratch, less);
+    }
+    else {
+        mergeHigh(bids, lo, mid, hi, scratch, less);
+    }
+}
+
+/**
+ * Perform a stable merge sort
+ * Average performance: O(n log(n))
+ * Worst case performance O(n log(n))
+ *
+ * Bottom-up natural merge sort: the vector is cut, left to right, into
+ * the ascending and strictly descending runs it already contains
+ * (descending runs are reversed, short runs are extended to MIN_RUN
+ * with insertion sort). Runs wait on a stack and neighbours are merged
+ * as soon as they are of similar length, as in Timsort, so a long
+ * sorted run is merged once with the short runs that follow it instead
+ * of being moved on every pass. Input made of r runs costs O(n log r)
+ * or less, so nearly sorted bids sort in close to linear time. Bids that
+ * compare equal keep their order, so sorting by title and then by fund
+ * leaves each fund in title order.
+ *
+ * @param bids address of the vector<Bid> instance to be sorted
+ * @param less strict weak ordering on bids
+ * @param scratch merge buffer, grown to half the size of bids if needed;
+ *                pass the same one to repeated sorts to reuse it
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename Less>
+void mergeSort(vector<Bid>& bids, Less less, vector<Bid>& scratch) {
+    int size = static_cast<int>(bids.size());
+    if (size < 2) {
+        return;
+    }
+    if (scratch.size() < bids.size() / 2) {
+        scratch.resize(bids.size() / 2);
+    }
+
+    // pending runs as (start, length), with lengths kept roughly decreasing
+    vector<pair<int, int> > runs;
+    auto mergeAt = [&](size_t r) {
+        mergeRuns(bids, runs[r].first, runs[r + 1].first,
+            runs[r + 1].first + runs[r + 1].second, scratch, less);
+        runs[r].second += runs[r + 1].second;
+        runs.erase(runs.begin() + r + 1);
+    };
+
+    int begin = 0;
+    while (begin < size) {
+        int end = begin + 1;
+        if (end < size && less(bids[end], bids[end - 1])) {
+            // strictly descending, so reversing it cannot reorder equal bids
+            while (end < size && less(bids[end], bids[end - 1])) {
+                ++end;
+            }
+            reverse(bids.begin() + begin, bids.begin() + end);
+        }
+        else {
+            while (end < size && !less(bids[end], bids[end - 1])) {
+                ++end;
+            }
+        }
+        if (end - begin < MIN_RUN) {
+            end = min(size, begin + MIN_RUN);
+            insertionSort(bids, begin, end, less);
+        }
+        runs.push_back(make_pair(begin, end - begin));
+        begin = end;
+
+        // merge until each run is longer than the two above it combined
+        while (runs.size() > 1) {
+            size_t r = runs.size() - 2;
+            if ((r > 0 && runs[r - 1].second <= runs[r].second + runs[r + 1].second)
+                || (r > 1 && runs[r - 2].second <= runs[r - 1].second + runs[r].second)) {
+                if (runs[r - 1].second < runs[r + 1].second) {
+                    --r;
+                }
+            }
+            else if (runs[r].second > runs[r + 1].second) {
+                break;
+            }
+            mergeAt(r);
+        }
+    }
+
+    while (runs.size() > 1) {
+        size_t r = runs.size() - 2;
+        if (r > 0 && runs[r - 1].second < runs[r + 1].second) {
+            --r;
+        }
+        mergeAt(r);
+    }
+}
+
+/**
+ * Perform a stable merge sort on bid title
+ *
+ * @param bids address of the vector<Bid> instance to be sorted
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void mergeSort(vector<Bid>& bids) {
+    vector<Bid> scratch;
+    mergeSort(bids, TitleLess(), scratch);
+}
+
+/**
+ * Sort bids by fund, and by title within each fund, with two stable
+ * passes over one shared scratch buffer
+ *
+ * @param bids address of the vector<Bid> instance to be sorted
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void sortByFundThenTitle(vector<Bid>& bids) {
+    vector<Bid> scratch;
+    mergeSort(bids, TitleLess(), scratch);
+    mergeSort(bids, FundLess(), scratch);
+}
+
+//============================================================================
+// Indirect sort (sorting a permutation instead of the bids)
+//============================================================================
+
+// position of a bid in its vector; 32 bits keep sort entries compact
+typedef uint32_t BidIndex;
+
+// order of a vector of bids: order[i] is the index of the bid that belongs at position i
+typedef vector<BidIndex> Permutation;
+
+/**
+ * Sort a permutation of the bids by one of their string fields, leaving
+ * the bids where they are. Only the 16-byte sort entries move, and most
+ * comparisons are settled on the packed prefixes without touching the
+ * bids, so the sort stays in cache. Several orders can be kept over one
+ * vector of bids without copying it.
+ *
+ * @param bids the bids to order
+ * @param field key to sort on, e.g. &Bid::title
+ * @return order of the bids; bids with equal keys keep their order
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+Permutation sortOrder(const vector<Bid>& bids, string Bid::* field) {
+    vector<SortEntry> entries(bids.size());
+    for (size_t i = 0; i < bids.size(); ++i) {
+        entries[i] = sortEntry(bids[i].*field, static_cast<BidIndex>(i));
+    }
+
+    int size = static_cast<int>(entries.size());
+    if (size > 1) {
+        EntryLess less([&bids, field](BidIndex index) -> const string& { return bids[index].*field; });
+        introSort(entries, 0, size, less, badPartitionLimit(size), true);
+    }
+
+    Permutation order(entries.size());
+    for (size_t i = 0; i < entries.size(); ++i) {
+        order[i] = entries[i].index;
+    }
+    return order;
+}
+
+/**
+ * Rearrange the bids into the given order. Each cycle of the
+ * permutation is followed once, so every bid is moved exactly once.
+ *
+ * @param bids address of the vector<Bid> instance to rearrange
+ * @param order permutation of the bids, e.g. from sortOrder
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void applyPermutation(vector<Bid>& bids, const Permutation& order) {
+    vector<bool> placed(order.size(), false);
+    for (BidIndex start = 0; start < order.size(); ++start) {
+        if (placed[start] || order[start] == start) {
+            continue;
+        }
+        Bid held = move(bids[start]);
+        BidIndex position = start;
+        while (order[position] != start) {
+            bids[position] = move(bids[order[position]]);
+            placed[position] = true;
+            position = order[position];
+        }
+        bids[position] = move(held);
+        placed[position] = true;
+    }
+}
+
+/**
+ * Perform a stable indirect sort: sort a permutation, then move every
+ * bid once into place
+ *
+ * @param bids address of the vector<Bid> instance to be sorted
+ * @param field key to sort on, e.g. &Bid::title
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void indirectSort(vector<Bid>& bids, string Bid::* field) {
+    applyPermutation(bids, sortOrder(bids, field));
+}
+
+//============================================================================
+// String radix sort (stable MSD radix sort)
+//============================================================================
+
+// buckets with fewer keys than this are finished with insertion sort
+const int RADIX_INSERTION_MAX = 32;
+
+/**
+ * One bid's string key for the radix sort: its characters, its length
+ * and the bid's index
+ */
+struct KeyRef {
+    const unsigned char* chars;
+    uint32_t length;
+    BidIndex index;
+};
+
+/**
+ * Bucket of key at depth: its byte there plus one, or 0 once the key
+ * has ended so shorter keys sort first
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+inline unsigned radixBucket(const KeyRef& key, uint32_t depth) {
+    return depth < key.length ? key.chars[depth] + 1u : 0u;
+}
+
+/**
+ * Three-way compare two keys whose first depth bytes are known to match
+ *
+ * @return <0, 0 or >0 like std::string::compare
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+int compareFrom(const KeyRef& a, const KeyRef& b, uint32_t depth) {
+    uint32_t common = min(a.length, b.length);
+    if (depth < common) {
+        int order = memcmp(a.chars + depth, b.chars + depth, common - depth);
+        if (order != 0) {
+            return order;
+        }
+    }
+    return a.length == b.length ? 0 : (a.length < b.length ? -1 : 1);
+}
+
+/**
+ * Stable MSD radix sort of keys[begin, end), whose first depth bytes
+ * all match
+ *
+ * Each level counts the keys per byte, distributes them through scratch
+ * in order and recurses into every bucket one byte deeper. Levels where
+ * all keys share the byte only advance the depth, so a long common
+ * prefix costs one pass per byte rather than a rescan in every
+ * comparison. Small buckets are finished with insertion sort on the
+ * remaining suffixes.
+ *
+ * @param scratch distribution buffer, as long as keys
+ * @param buckets per-key bucket cache, as long as keys
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void msdRadixSort(vector<KeyRef>& keys, vector<KeyRef>& scratch, vector<uint16_t>& buckets,
+                  int begin, int end, uint32_t depth) {
+    while (end - begin >= RADIX_INSERTION_MAX) {
+        int counts[257] = { 0 };
+        for (int i = begin; i < end; ++i) {
+            buckets[i] = static_cast<uint16_t>(radixBucket(keys[i], depth));
+            ++counts[buckets[i]];
+        }
+
+        if (counts[buckets[begin]] == end - begin) {
+            if (buckets[begin] == 0) {
+                return; // every key has ended, so they are all equal
+            }
+            ++depth; // every key shares this byte
+            continue;
+        }
+
+        int offsets[257];
+        int offset = begin;
+        for (int b = 0; b < 257; ++b) {
+            offsets[b] = offset;
+            offset += counts[b];
+        }
+        for (int i = begin; i < end; ++i) {
+            scratch[offsets[buckets[i]]++] = keys[i];
+        }
+        copy(scratch.begin() + begin, scratch.begin() + end, keys.begin() + begin);
+
+        // bucket 0 holds keys that ended here; they are equal and in order
+        int start = begin + counts[0];
+        for (int b = 1; b < 257; ++b) {
+            if (counts[b] > 1) {
+                msdRadixSort(keys, scratch, buckets, start, start + counts[b], depth + 1);
+            }
+            start += counts[b];
+        }
+        return;
+    }
+
+    insertionSort(keys, begin, end, [depth](const KeyRef& a, const KeyRef& b) {
+        return compareFrom(a, b, depth) < 0;
+    });
+}
+
+/**
+ * Order the bids by one of their string fields with a stable MSD radix
+ * sort, leaving the bids where they are
+ *
+ * Sorting n keys costs time in proportion to the bytes needed to tell
+ * them apart, not O(n log n) comparisons that each rescan the prefix.
+ * Titles that share long prefixes gain the most.
+ *
+ * @param bids the bids to order
+ * @param field key to sort on, e.g. &Bid::title or &Bid::fund
+ * @return order of the bids; bids with equal keys keep their order
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+Permutation radixSortOrder(const vector<Bid>& bids, string Bid::* field) {
+    vector<KeyRef> keys(bids.size());
+    for (size_t i = 0; i < bids.size(); ++i) {
+        const string& key = bids[i].*field;
+        keys[i].chars = reinterpret_cast<const unsigned char*>(key.data());
+        keys[i].length = static_cast<uint32_t>(key.size());
+        keys[i].index = static_cast<BidIndex>(i);
+    }
+
+    vector<KeyRef> scratch(keys.size());
+    vector<uint16_t> buckets(keys.size());
+    msdRadixSort(keys, scratch, buckets, 0, static_cast<int>(keys.size()), 0);
+
+    Permutation order(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        order[i] = keys[i].index;
+    }
+    return order;
+}
+
+/**
+ * Perform a stable radix sort on one of the bids' string fields
+ *
+ * @param bids address of the vector<Bid> instance to be sorted
+ * @param field key to sort on, e.g. &Bid::title or &Bid::fund
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void radixSort(vector<Bid>& bids, string Bid::* field) {
+    applyPermutation(bids, radixSortOrder(bids, field));
+}
+
+//============================================================================
+// Numeric radix sort (stable LSD radix sort on 64-bit keys)
+//============================================================================
+
+/**
+ * Numeric fields a bid can be sorted on
+ */
+enum class NumericKey { Amount, BidId, CloseDate };
+
+/**
+ * Order-preserving 64-bit key of one of a bid's numeric fields
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+uint64_t numericKey(const Bid& bid, NumericKey key) {
+    switch (key) {
+    case NumericKey::Amount:
+        return amountKey(bid.amount);
+    case NumericKey::BidId:
+        return bidIdKey(bid.bidId);
+    default:
+        return closeDateKey(bid.closeDate);
+    }
+}
+
+/**
+ * Order the bids by one of their numeric fields in linear time, leaving
+ * the bids where they are
+ *
+ * @param bids the bids to order
+ * @param key field to sort on
+ * @return order of the bids; bids with equal keys keep their order
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+Permutation numericSortOrder(const vector<Bid>& bids, NumericKey key) {
+    vector<NumericEntry> entries(bids.size());
+    for (size_t i = 0; i < bids.size(); ++i) {
+        entries[i].key = numericKey(bids[i], key);
+        entries[i].index = static_cast<BidIndex>(i);
+    }
+
+    lsdRadixSort(entries);
+
+    Permutation order(entries.size());
+    for (size_t i = 0; i < entries.size(); ++i) {
+        order[i] = entries[i].index;
+    }
+    return order;
+}
+
+/**
+ * Perform a stable radix sort on one of the bids' numeric fields
+ *
+ * @param bids address of the vector<Bid> instance to be sorted
+ * @param key field to sort on
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void numericSort(vector<Bid>& bids, NumericKey key) {
+    applyPermutation(bids, numericSortOrder(bids, key));
+}
+
+//============================================================================
+// Top-K and partial sort (introselect and bounded heaps)
+//============================================================================
+
+// partialSort selects with a heap when k is at most this fraction of the bids
+const int HEAP_SELECT_FRACTION = 64;
+
+/**
+ * Orders two bids by amount, largest first, for leaderboard queries
+ */
+struct AmountGreater {
+    bool operator()(const Bid& a, const Bid& b) const {
+        return a.amount > b.amount;
+    }
+};
+
+/**
+ * Heap select: leave items[nth] where a full sort of items[begin, end)
+ * would put it, with no larger item before it and no smaller one after.
+ * The nth - begin + 1 smallest items so far are kept in a max-heap at
+ * the front, and each later item only enters it by replacing the top.
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename T, typename Less>
+void heapSelect(vector<T>& items, int begin, int end, int nth, Less less) {
+    int size = nth - begin + 1;
+    for (int root = size / 2 - 1; root >= 0; --root) {
+        siftDown(items, begin, root, size, less);
+    }
+    for (int i = nth + 1; i < end; ++i) {
+        if (less(items[i], items[begin])) {
+            swap(items[i], items[begin]);
+            siftDown(items, begin, 0, size, less);
+        }
+    }
+    swap(items[begin], items[nth]);
+}
+
+/**
+ * Introselect: leave items[nth] where a full sort of items[begin, end)
+ * would put it, with no larger item before it and no smaller one after
+ *
+ * Partitions like introSort but only follows the side holding nth, so
+ * it takes linear time on average. Runs of equal keys are split off
+ * with partitionLeft, and a range that produces badAllowed lopsided
+ * partitions is finished by heapSelect.
+ *
+ * @param badAllowed lopsided partitions left before falling back to heap select
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename T, typename Less>
+void introSelect(vector<T>& items, int begin, int end, int nth, Less less, int badAllowed) {
+    bool leftmost = true;
+    while (end - begin > INSERTION_SORT_MAX) {
+        int size = end - begin;
+        choosePivot(items, begin, end, less);
+
+        // the item before this range is <= every item in it, so a pivot equal to it is the minimum
+        if (!leftmost && !less(items[begin - 1], items[begin])) {
+            int last = partitionLeft(items, begin, end, less);
+            if (nth <= last) {
+                return; // items[begin, last] all equal the pivot
+            }
+            begin = last + 1;
+            continue;
+        }
+
+        bool alreadyPartitioned;
+        int pivot = partitionRight(items, begin, end, less, alreadyPartitioned);
+        if (pivot == nth) {
+            return;
+        }
+        if (pivot - begin < size / 8 || end - (pivot + 1) < size / 8) {
+            if (--badAllowed == 0) {
+                heapSelect(items, begin, end, nth, less);
+                return;
+            }
+            breakPatterns(items, begin, pivot);
+            breakPatterns(items, pivot + 1, end);
+        }
+
+        if (nth < pivot) {
+            end = pivot;
+        }
+        else {
+            begin = pivot + 1;
+            leftmost = false;
+        }
+    }
+    insertionSort(items, begin, end, less);
+}
+
+/**
+ * Sort only the first k bids: afterwards bids[0, k) hold the k smallest
+ * bids under less, in order, and the rest follow in no particular order.
+ * The kth bid is placed by heapSelect when k is small, since most bids
+ * then cost one comparison against the heap top and are never moved,
+ * and by introSelect otherwise; introSort then orders the bids before
+ * it. Bids that compare equal may be reordered.
+ *
+ * @param bids address of the vector<Bid> instance to be partially sorted
+ * @param k number of bids to sort; the whole vector if larger
+ * @param less ordering to sort by, e.g. TitleLess()
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename Less>
+void partialSort(vector<Bid>& bids, size_t k, Less less) {
+    int size = static_cast<int>(bids.size());
+    int count = static_cast<int>(min(k, bids.size()));
+    if (count == 0) {
+        return;
+    }
+    if (count <= size / HEAP_SELECT_FRACTION) {
+        heapSelect(bids, 0, size, count - 1, less);
+        --count; // the kth bid is already in place
+    }
+    else if (count < size) {
+        introSelect(bids, 0, size, count - 1, less, badPartitionLimit(size));
+        --count;
+    }
+    introSort(bids, 0, count, less, badPartitionLimit(count), true);
+}
+
+/**
+ * Max-heap holding the best (smallest under less) items offered so far,
+ * at most capacity of them, which must be at least 1. The worst item
+ * kept is on top, so deciding whether a new item belongs takes one
+ * comparison and admitting it takes O(log capacity).
+ */
+template <typename T, typename Less>
+class BoundedHeap {
+
+private:
+    vector<T> items;
+    size_t capacity;
+    Less less;
+
+public:
+    BoundedHeap(size_t aCapacity, Less aLess) : capacity(aCapacity), less(aLess) {
+        items.reserve(aCapacity);
+    }
+
+    bool Full() const {
+        return items.size() >= capacity;
+    }
+
+    const T& Top() const {
+        return items.front();
+    }
+
+    /**
+     * Keep item if it is among the best seen, dropping the current worst
+     * when the heap is full
+     */
+    void Offer(T item) {
+        if (!Full()) {
+            // sift the new item up from the end
+            int hole = static_cast<int>(items.size());
+            items.push_back(move(item));
+            T moving = move(items[hole]);
+            while (hole > 0 && less(items[(hole - 1) / 2], moving)) {
+                items[hole] = move(items[(hole - 1) / 2]);
+                hole = (hole - 1) / 2;
+            }
+            items[hole] = move(moving);
+        }
+        else if (less(item, items.front())) {
+            items.front() = move(item);
+            siftDown(items, 0, 0, static_cast<int>(items.size()), less);
+        }
+    }
+
+    /**
+     * Empty the heap, returning its items best first
+     */
+    vector<T> TakeSorted() {
+        heapSort(items, 0, static_cast<int>(items.size()), less);
+        vector<T> sorted;
+        sorted.swap(items);
+        return sorted;
+    }
+};
+
+/**
+ * Orders bid indexes by their bids under less, settling ties on the
+ * index so the top k come out as a stable sort would rank them
+ */
+template <typename Less>
+struct IndexLess {
+    const vector<Bid>* bids;
+    Less less;
+
+    bool operator()(BidIndex a, BidIndex b) const {
+        if (less((*bids)[a], (*bids)[b])) {
+            return true;
+        }
+        if (less((*bids)[b], (*bids)[a])) {
+            return false;
+        }
+        return a < b;
+    }
+};
+
+/**
+ * Indexes of the k best bids under less, best first, leaving the bids
+ * untouched. One pass through a bounded heap of k indexes: O(n log k)
+ * time and O(k) extra memory. Bids that compare equal are ranked in
+ * vector order.
+ *
+ * @param bids the bids to rank
+ * @param k number of bids wanted
+ * @param less ranking, e.g. AmountGreater() for the largest bids
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename Less>
+Permutation topKOrder(const vector<Bid>& bids, size_t k, Less less) {
+    if (k == 0 || bids.empty()) {
+        return Permutation();
+    }
+    BoundedHeap<BidIndex, IndexLess<Less> > heap(min(k, bids.size()), IndexLess<Less>{ &bids, less });
+    for (size_t i = 0; i < bids.size(); ++i) {
+        heap.Offer(static_cast<BidIndex>(i));
+    }
+    return heap.TakeSorted();
+}
+
+/**
+ * Copies of the k best bids under less, best first
+ *
+ * @param bids the bids to rank
+ * @param k number of bids wanted
+ * @param less ranking, e.g. AmountGreater() for the largest bids
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename Less>
+vector<Bid> topK(const vector<Bid>& bids, size_t k, Less less) {
+    vector<Bid> top;
+    for (BidIndex index : topKOrder(bids, k, less)) {
+        top.push_back(bids[index]);
+    }
+    return top;
+}
+
+/**
+ * Bid kept by the streaming top-k, with its position in the file to
+ * rank ties
+ */
+struct RankedBid {
+    Bid bid;
+    size_t position;
+};
+
+/**
+ * Orders ranked bids under less, then by file position
+ */
+template <typename Less>
+struct RankedLess {
+    Less less;
+
+    bool operator()(const RankedBid& a, const RankedBid& b) const {
+        if (less(a.bid, b.bid)) {
+            return true;
+        }
+        if (less(b.bid, a.bid)) {
+            return false;
+        }
+        return a.position < b.position;
+    }
+};
+
+/**
+ * Read the k best bids under less from a CSV file without loading the
+ * rest: the file is streamed one bid at a time and only a bounded heap
+ * of k bids is kept. Returns the same bids as topK over loadBids.
+ *
+ * @param csvPath the path to the CSV file to read
+ * @param k number of bids wanted
+ * @param less ranking, e.g. AmountGreater() for the largest bids
+ * @return the k best bids, best first
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename Less>
+vector<Bid> loadTopBids(string csvPath, size_t k, Less less) {
+    if (k == 0) {
+        return vector<Bid>();
+    }
+    BoundedHeap<RankedBid, RankedLess<Less> > heap(k, RankedLess<Less>{ less });
+    size_t position = 0;
+    ExternalSort::ReadBids(csvPath, [&](const Bid& bid) {
+        // a later bid must beat the worst kept one outright, so check before copying it
+        if (!heap.Full() || less(bid, heap.Top().bid)) {
+            heap.Offer(RankedBid{ bid, position });
+        }
+        ++position;
+    });
+
+    vector<Bid> top;
+    for (RankedBid& ranked : heap.TakeSorted()) {
+        top.push_back(move(ranked.bid));
+    }
+    return top;
+}
+
+//============================================================================
+// Composite sort keys (comparators built at compile time)
+//============================================================================
+
+/**
+ * Three-way comparison of two key values: negative, zero or positive as
+ * a sorts before, with or after b
+ *
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+inline int threeWay(const string& a, const string& b) {
+    return a.compare(b);
+}
+
+template <typename Number>
+int threeWay(Number a, Number b) {
+    return (b < a) - (a < b);
+}
+
+/**
+ * Sort key column read straight from a member of the bid
+ */
+template <auto Member>
+struct Column {
+    static const auto& value(const Bid& bid) {
+        return bid.*Member;
+    }
+};
+
+typedef Column<&Bid::title> TitleColumn;
+typedef Column<&Bid::fund> FundColumn;
+typedef Column<&Bid::amount> AmountColumn;
+
+/**
+ * Sort key column for the auction id, compared as a number
+ */
+struct IdColumn {
+    static uint64_t value(const Bid& bid) {
+        return bidIdKey(bid.bidId);
+    }
+};
+
+/**
+ * Sort key column for the close date, compared as yyyymmdd
+ */
+struct DateColumn {
+    static uint64_t value(const Bid& bid) {
+        return closeDateKey(bid.closeDate);
+    }
+};
+
+/**
+ * Sort key that orders a column from smallest to largest
+ */
+template <typename Column>
+struct Ascending {
+    static int compare(const Bid& a, const Bid& b) {
+        return threeWay(Column::value(a), Column::value(b));
+    }
+};
+
+/**
+ * Sort key that orders a column from largest to smallest
+ */
+template <typename Column>
+struct Descending {
+    static int compare(const Bid& a, const Bid& b) {
+        return threeWay(Column::value(b), Column::value(a));
+    }
+};
+
+/**
+ * Orders two bids by a list of sort keys, each one settling the ties
+ * left by those before it, e.g.
+ * ByKeys<Ascending<FundColumn>, Descending<AmountColumn>, Ascending<TitleColumn> >.
+ * The keys are fixed at compile time, so the whole comparison inlines
+ * into the sort like a hand-written comparator: no std::function, no
+ * virtual calls, and later keys are only read on a tie.
+ */
+template <typename... Keys>
+struct ByKeys {
+    bool operator()(const Bid& a, const Bid& b) const {
+        int order = 0;
+        // stop at the first key that tells the bids apart
+        static_cast<void>((((order = Keys::compare(a, b)) != 0) || ...));
+        return order < 0;
+    }
+};
+
+/**
+ * Stable merge sort by a composite key, with its own scratch buffer
+ *
+ * @param bids address of the vector<Bid> instance to be sorted
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+template <typename Less>
+void sortBy(vector<Bid>& bids) {
+    vector<Bid> scratch;
+    mergeSort(bids, Less(), scratch);
+}
+
+/**
+ * Report order the menu can sort by: its key list ("-" for largest
+ * first) and the sort instantiated for it
+ */
+struct ReportOrder {
+    const char* keys;
+    void (*sort)(vector<Bid>&);
+};
+
+// every report order instantiated in the program
+const ReportOrder REPORT_ORDERS[] = {
+    { "title", &sortBy<ByKeys<Ascending<TitleColumn> > > },
+    { "-title", &sortBy<ByKeys<Descending<TitleColumn> > > },
+    { "fund,title", &sortBy<ByKeys<Ascending<FundColumn>, Ascending<TitleColumn> > > },
+    { "fund,-amount,title", &sortBy<ByKeys<Ascending<FundColumn>, Descending<AmountColumn>, Ascending<TitleColumn> > > },
+    { "fund,date,title", &sortBy<ByKeys<Ascending<FundColumn>, Ascending<DateColumn>, Ascending<TitleColumn> > > },
+    { "amount,title", &sortBy<ByKeys<Ascending<AmountColumn>, Ascending<TitleColumn> > > },
+    { "-amount,title", &sortBy<ByKeys<Descending<AmountColumn>, Ascending<TitleColumn> > > },
+    { "date,title", &sortBy<ByKeys<Ascending<DateColumn>, Ascending<TitleColumn> > > },
+    { "-date,-amount", &sortBy<ByKeys<Descending<DateColumn>, Descending<AmountColumn> > > },
+    { "id", &sortBy<ByKeys<Ascending<IdColumn> > > },
+};
+
+/**
+ * Sort the bids by one of the report orders, named by its key list,
+ * e.g. "fund,-amount,title"
+ *
+ * @param bids address of the vector<Bid> instance to be sorted
+ * @param keys key list of the report order
+ * @return false, leaving the bids as they were, if no report order has
+ *         that key list
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+bool sortByKeys(vector<Bid>& bids, const string& keys) {
+    for (const ReportOrder& order : REPORT_ORDERS) {
+        if (keys == order.keys) {
+            order.sort(bids);
+            return true;
+        }
+    }
+    return false;
+}
+
+// FIXME (1a): Implement the selection sort logic over bid.title
+
+/**
+ * Perform a selection sort on bid title
+ * Average performance: O(n^2))
+ * Worst case performance O(n^2))
+ *
+ * @param bid address of the vector<Bid>
+ *            instance to be sorted
+ */
+/*
+* Date: 7/13/2025
+* Author: Dylan Harmon 
+*/
+void selectionSort(vector<Bid>& bids) {
+ 
+	// for loop where i denotes the dividing point where elements to the left are sorted.
+	// elements including I and to the right are unsorted.
+    for (int i = 0; i < bids.size() - 1; ++i) {
+        // set minIndex to i
+        int minIndex = i;
+
+		// search the unsorted elements to the right of i
+		// for the smallest element: minIndex stores the index of the smallest element found.
+        
+        for (int j = i + 1; j < bids.size(); ++j) {
+
+            // if this element's title is less than minimum title
+                // this element becomes the minimum
+            if (bids[j].title < bids[minIndex].title) {
+                minIndex = j;
+            }
+        }
+
+        // Indeces for the sorted and unsorted parts are updated
+
+        std::swap(bids[i], bids[minIndex]);
+    }
+
+}
+
+//============================================================================
+// Benchmarks
+//============================================================================
+
+/**
+ * Print the elapsed time of one benchmark step
+ *
+ * @param label what was timed
+ * @param ticks elapsed clock ticks
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void reportTime(const string& label, clock_t ticks) {
+    cout << "  " << label << ": " << ticks << " clock ticks, "
+        << ticks * 1.0 / CLOCKS_PER_SEC << " seconds" << endl;
+}
+
+/**
+ * Print a wall-clock time for the benchmarks. clock() adds up the CPU
+ * time of every thread, which hides any speedup from running in parallel.
+ *
+ * @param label what was timed
+ * @param elapsed wall-clock time taken
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void reportSeconds(const string& label, chrono::steady_clock::duration elapsed) {
+    cout << "  " << label << ": " << chrono::duration<double>(elapsed).count()
+        << " seconds" << endl;
+}
+
+/**
+ * Time quickSort, parallelQuickSort, mergeSort, indirectSort and
+ * radixSort against std::sort and std::stable_sort on the loaded bids,
+ * on nearly sorted bids and on the arrangements that make a naive quick
+ * sort quadratic, then time numeric sorts on amount, bid id and close
+ * date, topK and partialSort against std::partial_sort, a composite
+ * sort key against hand-written and std::function comparators, and
+ * scans and sorts of a BidColumns store against vector<Bid>
+ *
+ * @param bids the bids to arrange and sort
+ * @param pool workers for the parallel sort
+ * Author: Dylan Harmon
+ * Date: 10/19/2026
+ */
+void benchmarkSorts(const vector<Bid>& bids, ThreadPool& pool) {
+    // repeat the file so small exports still give measurable times
+    const size_t TARGET_BIDS = 1000000;
+    if (bids.empty()) {
+        return;
+    }
+    vector<Bid> base;
+    base.reserve(TARGET_BIDS);
+    while (base.size() < TARGET_BIDS) {
+        base.push_back(bids[base.size() % bids.size()]);
+    }
+
+    vector<pair<string, vector<Bid> > > inputs;
+    inputs.emplace_back("file order", base);
+    vector<Bid> arranged(base);
+    shuffle(arranged.begin(), arranged.end(), mt19937(42));
+    inputs.emplace_back("shuffled", arranged);
+    vector<Bid> prefixed(arranged);
+    for (Bid& bid : prefixed) {
+        bid.title = "Surplus Property Auction, Lot Description: " + bid.title;
+    }
+    inputs.emplace_back("shuffled, 43-byte shared title prefix", prefixed);
+    sort(arranged.begin(), arranged.end(), TitleLess());
+    inputs.emplace_back("sorted", arranged);
+    vector<Bid> nearly(arranged);
+    mt19937 rng(7);
+    for (size_t i = 0; i < nearly.size() / 100; ++i) {
+        swap(nearly[rng() % nearly.size()], nearly[rng() % nearly.size()]);
+    }
+    inputs.emplace_back("nearly sorted (1% swapped)", nearly);
+    vector<Bid> appended(arranged.begin(), arranged.end() - arranged.size() / 100);
+    appended.insert(appended.end(), base.end() - base.size() / 100, base.end());
+    inputs.emplace_back("sorted, 1% appended", appended);
+    reverse(arranged.begin(), arranged.end());
+    inputs.emplace_back("reversed", arranged);
+    for (size_t i = 0; i < arranged.size(); ++i) {
+        arranged[i].title = bids[i % 16].title;
+    }
+    inputs.emplace_back("16 distinct titles", arranged);
+    for (Bid& bid : arranged) {
+        bid.title = bids[0].title;
+    }
+    inputs.emplace_back("all titles equal", arranged);
+
+    cout << base.size() << " bids" << endl;
+    for (const pair<string, vector<Bid> >& input : inputs) {
+        cout << input.first << endl;
+
+        vector<Bid> sorted(input.second);
+        clock_t ticks = clock();
+        quickSort(sorted, 0, static_cast<int>(sorted.size()) - 1);
+        reportTime("quickSort", clock() - ticks);
+        if (!is_sorted(sorted.begin(), sorted.end(), TitleLess())) {
+            cout << "  quickSort output is out of order" << endl;
+        }
+
+        vector<Bid> parallel(input.second);
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        parallelQuickSort(parallel, pool);
+        reportSeconds("parallelQuickSort, " + to_string(pool.Size()) + " threads",
+            chrono::steady_clock::now() - start);
+        for (size_t i = 0; i < parallel.size(); ++i) {
+            if (parallel[i].bidId != sorted[i].bidId) {
+                cout << "  parallelQuickSort output differs from quickSort" << endl;
+                break;
+            }
+        }
+
+        sorted = input.second;
+        ticks = clock();
+        sort(sorted.begin(), sorted.end(), TitleLess());
+        reportTime("std::sort", clock() - ticks);
+
+        vector<Bid> merged(input.second);
+        ticks = clock();
+        mergeSort(merged);
+        reportTime("mergeSort", clock() - ticks);
+
+        sorted = input.second;
+        ticks = clock();
+        stable_sort(sorted.begin(), sorted.end(), TitleLess());
+        reportTime("std::stable_sort", clock() - ticks);
+        for (size_t i = 0; i < merged.size(); ++i) {
+            if (merged[i].bidId != sorted[i].bidId) {
+                cout << "  mergeSort output differs from std::stable_sort" << endl;
+                break;
+            }
+        }
+
+        vector<Bid> indirect(input.second);
+        ticks = clock();
+        Permutation order = sortOrder(indirect, &Bid::title);
+        reportTime("sortOrder", clock() - ticks);
+        applyPermutation(indirect, order);
+        reportTime("sortOrder + applyPermutation", clock() - ticks);
+        for (size_t i = 0; i < indirect.size(); ++i) {
+            if (indirect[i].bidId != sorted[i].bidId) {
+                cout << "  indirectSort output differs from std::stable_sort" << endl;
+                break;
+            }
+        }
+
+        vector<Bid> radix(input.second);
+        ticks = clock();
+        order = radixSortOrder(radix, &Bid::title);
+        reportTime("radixSortOrder", clock() - ticks);
+        applyPermutation(radix, order);
+        reportTime("radixSortOrder + applyPermutation", clock() - ticks);
+        for (size_t i = 0; i < radix.size(); ++i) {
+            if (radix[i].bidId != sorted[i].bidId) {
+                cout << "  radixSort output differs from std::stable_sort" << endl;
+                break;
+            }
+        }
+    }
+
+    const NumericKey keys[] = { NumericKey::Amount, NumericKey::BidId, NumericKey::CloseDate };
+    const char* keyNames[] = { "amount", "bid id", "close date" };
+    const vector<Bid>& shuffled = inputs[1].second;
+    cout << "shuffled, numeric keys" << endl;
+    for (size_t k = 0; k < 3; ++k) {
+        vector<Bid> sorted(shuffled);
+        clock_t ticks = clock();
+        Permutation order = numericSortOrder(sorted, keys[k]);
+        reportTime(string("numericSortOrder (") + keyNames[k] + ")", clock() - ticks);
+        for (size_t i = 1; i < order.size(); ++i) {
+            uint64_t previous = numericKey(shuffled[order[i - 1]], keys[k]);
+            uint64_t current = numericKey(shuffled[order[i]], keys[k]);
+            if (current < previous || (current == previous && order[i] < order[i - 1])) {
+                cout << "  numericSortOrder output is out of order" << endl;
+                break;
+            }
+        }
+        applyPermutation(sorted, order);
+        reportTime(string("numericSortOrder + applyPermutation (") + keyNames[k] + ")", clock() - ticks);
+    }
+    vector<Bid> sorted(shuffled);
+    clock_t ticks = clock();
+    stable_sort(sorted.begin(), sorted.end(), [](const Bid& a, const Bid& b) { return a.amount < b.amount; });
+    reportTime("std::stable_sort (amount)", clock() - ticks);
+
+    // leaderboard queries: the largest amounts and the first page of titles
+    const size_t TOP_COUNTS[] = { 100, 10000 };
+    for (size_t k : TOP_COUNTS) {
+        cout << "shuffled, top " << k << endl;
+
+        ticks = clock();
+        vector<Bid> top = topK(shuffled, k, AmountGreater());
+        reportTime("topK (amount)", clock() - ticks);
+        for (size_t i = 0; i < top.size(); ++i) {
+            if (top[i].amount != sorted[sorted.size() - 1 - i].amount) {
+                cout << "  topK output differs from std::stable_sort" << endl;
+                break;
+            }
+        }
+
+        vector<Bid> partial(shuffled);
+        ticks = clock();
+        partialSort(partial, k, AmountGreater());
+        reportTime("partialSort (amount)", clock() - ticks);
+        for (size_t i = 0; i < k; ++i) {
+            if (partial[i].amount != top[i].amount) {
+                cout << "  partialSort output differs from topK" << endl;
+                break;
+            }
+        }
+
+        partial = shuffled;
+        ticks = clock();
+        partial_sort(partial.begin(), partial.begin() + k, partial.end(), AmountGreater());
+        reportTime("std::partial_sort (amount)", clock() - ticks);
+
+        ticks = clock();
+        top = topK(shuffled, k, TitleLess());
+        reportTime("topK (title)", clock() - ticks);
+
+        partial = shuffled;
+        ticks = clock();
+        partialSort(partial, k, TitleLess());
+        reportTime("partialSort (title)", clock() - ticks);
+        for (size_t i = 0; i < k; ++i) {
+            if (partial[i].title != top[i].title) {
+                cout << "  partialSort output differs from topK" << endl;
+                break;
+            }
+        }
+    }
+
+    // one report order through a composite key, a hand-written comparator and std::function
+    typedef ByKeys<Ascending<FundColumn>, Descending<AmountColumn>, Ascending<TitleColumn> > FundAmountTitle;
+    auto handWritten = [](const Bid& a, const Bid& b) {
+        if (a.fund != b.fund) {
+            return a.fund < b.fund;
+        }
+        if (a.amount != b.amount) {
+            return a.amount > b.amount;
+        }
+        return a.title < b.title;
+    };
+    cout << "shuffled, fund, -amount, title" << endl;
+
+    vector<Bid> composite(shuffled);
+    ticks = clock();
+    sortBy<FundAmountTitle>(composite);
+    reportTime("sortBy<ByKeys>", clock() - ticks);
+
+    vector<Bid> scratch;
+    sorted = shuffled;
+    ticks = clock();
+    mergeSort(sorted, handWritten, scratch);
+    reportTime("mergeSort, hand-written comparator", clock() - ticks);
+    for (size_t i = 0; i < composite.size(); ++i) {
+        if (composite[i].bidId != sorted[i].bidId) {
+            cout << "  sortBy<ByKeys> output differs from the hand-written comparator" << endl;
+            break;
+        }
+    }
+
+    sorted = shuffled;
+    ticks = clock();
+    mergeSort(sorted, function<bool(const Bid&, const Bid&)>(handWritten), scratch);
+    reportTime("mergeSort, std::function comparator", clock() - ticks);
+
+    // the same bids stored a column at a time
+    cout << "shuffled, column store" << endl;
+    ticks = clock();
+    BidColumns columns(shuffled);
+    reportTime("BidColumns from vector<Bid>", clock() - ticks);
+    cout << "  " << columns.Bytes() / (1024 * 1024) << " MB in columns, "
+        << shuffled.size() * sizeof(Bid) / (1024 * 1024) << " MB of Bid structs alone" << endl;
+
+    const int SCANS = 20;
+    double total = 0.0;
+    ticks = clock();
+    for (int scan = 0; scan < SCANS; ++scan) {
+        for (const Bid& bid : shuffled) {
+            total += bid.amount;
+        }
+    }
+    reportTime("sum of amounts x" + to_string(SCANS) + ", vector<Bid>", clock() - ticks);
+    double columnTotal = 0.0;
+    ticks = clock();
+    for (int scan = 0; scan < SCANS; ++scan) {
+        for (double amount : columns.Amounts()) {
+            columnTotal += amount;
+        }
+    }
+    reportTime("sum of amounts x" + to_string(SCANS) + ", BidColumns", clock() - ticks);
+    if (columnTotal != total) {
+        cout << "  BidColumns sum differs from vector<Bid>" << endl;
+    }
+
+    ticks = clock();
+    Permutation order = columns.SortOrder(BidColumns::AMOUNT);
+    reportTime("BidColumns::SortOrder (amount)", clock() - ticks);
+    if (order != numericSortOrder(shuffled, NumericKey::Amount)) {
+        cout << "  BidColumns order differs from numericSortOrder" << endl;
+    }
+
+    ticks = clock();
+    order = columns.SortOrder(BidColumns::ID);
+    reportTime("BidColumns::SortOrder (id)", clock() - ticks);
+    if (order != numericSortOrder(shuffled, NumericKey::BidId)) {
+        cout << "  BidColumns order differs from numericSortOrder" << endl;
+    }
+
+    ticks = clock();
+    order = columns.SortOrder(BidColumns::TITLE);
+    reportTime("BidColumns::SortOrder (title)", clock() - ticks);
+    columns.Permute(order);
+    reportTime("BidColumns::SortOrder + Permute (title)", clock() - ticks);
+    if (order != sortOrder(shuffled, &Bid::title)) {
+        cout << "  BidColumns order differs from sortOrder" << endl;
+    }
+
+    vector<Bid> indirect(shuffled);
+    ticks = clock();
+    indirectSort(indirect, &Bid::title);
+    reportTime("indirectSort (title), vector<Bid>", clock() - ticks);
+}
+
+/**
+ * Simple C function to convert a string to a double
+ * after stripping out unwanted char
+ *
+ * credit: http://stackoverflow.com/a/24875936
+ *
+ * @param ch The character to strip out
+ */
+double strToDouble(string str, char ch) {
+    str.erase(remove(str.begin(), str.end(), ch), str.end());
+    return atof(str.c_str());
+}
+
+/**
+ * The one and only main() method
+ */
+int main(int argc, char* argv[]) {
+
+    // process command line arguments
+    string csvPath;
+    unsigned threads = 0; // one per hardware thread
+    switch (argc) {
+    case 2:
+        csvPath = argv[1];
+        break;
+    case 3:
+        csvPath = argv[1];
+        threads = static_cast<unsigned>(atoi(argv[2]));
+        break;
+    default:
+        csvPath = "eBid_Monthly_Sales.csv";
+    }
+
+    // Define a vector to hold all the bids
+    vector<Bid> bids;
+
+    // Define a timer variable
+    clock_t ticks;
+
+    // Define the workers for the parallel sort
+    ThreadPool pool(threads);
+
+    int choice = 0;
+    while (choice != 9) {
+        cout << "Menu:" << endl;
+        cout << "  1. Load Bids" << endl;
+        cout << "  2. Display All Bids" << endl;
+        cout << "  3. Selection Sort All Bids" << endl;
+        cout << "  4. Quick Sort All Bids" << endl;
+        cout << "  5. Benchmark Sorts" << endl;
+        cout << "  6. Parallel Quick Sort All Bids" << endl;
+        cout << "  7. Merge Sort All Bids (stable)" << endl;
+        cout << "  8. Sort All Bids by Fund, then Title" << endl;
+        cout << "  10. Indirect Sort All Bids" << endl;
+        cout << "  11. Radix Sort All Bids" << endl;
+        cout << "  12. External Sort Bid File" << endl;
+        cout << "  13. Top Bids from File" << endl;
+        cout << "  14. Sort All Bids for a Report" << endl;
+        cout << "  15. Sort All Bids through Columns" << endl;
+        cout << "  9. Exit" << endl;
+        cout << "Enter choice: ";
+        cin >> choice;
+
+        switch (choice) {
+
+        case 1:
+            // Initialize a timer variable before loading bids
+            ticks = clock();
+
+            // Complete the method call to load the bids
+            bids = loadBids(csvPath);
+
+            cout << bids.size() << " bids read" << endl;
+
+            // Calculate elapsed time and display result
+            ticks = clock() - ticks; // current clock ticks minus starting clock ticks
+            cout << "time: " << ticks << " clock ticks" << endl;
+            cout << "time: " << ticks * 1.0 / CLOCKS_PER_SEC << " seconds" << endl;
+
+            break;
+
+        case 2:
+            // Loop and display the bids read
+            for (int i = 0; i < bids.size(); ++i) {
+                displayBid(bids[i]);
+            }
+            cout << endl;
+
+            break;
+
+        case 3:
+            // switch for selection sort
+            // start clock with ticks, then invoke selection sort
+            ticks = clock();
+
+            selectionSort(bids);
+
+            // after sort; end clock and calculate time elapsed
+            ticks = clock() - ticks; // current clock ticks minus starting clock ticks gives time elapsed
+
+			cout << bids.size() << " bids sorted" << endl;
+            // display time in ticks and in seconds
+            cout << "time: " << ticks << " clock ticks" << endl;
+            cout << "time: " << ticks * 1.0 / CLOCKS_PER_SEC << " seconds" << endl;
+
+
+            break;
+        case 4:
+            // switch for quick sort
+            
+
+            // start clock with ticks, then invoke quick sort
+            ticks = clock();
+            quickSort(bids, 0, bids.size() - 1);
+
+            // after sort; end clock and calculate time elapsed
+			ticks = clock() - ticks; // current clock ticks minus starting clock ticks gives time elapsed
+
+            cout << bids.size() << " bids sorted" << endl;
+
+            // display time in ticks and in seconds
+            cout << "time: " << ticks << " clock ticks" << endl;
+            cout << "time: " << ticks * 1.0 / CLOCKS_PER_SEC << " seconds" << endl;
+
+            break;
+
+        case 5:
+            benchmarkSorts(loadBids(csvPath), pool);
+
+            break;
+
+        case 6: {
+            // clock() would add up every worker's time, so measure wall-clock time
+            chrono::steady_clock::time_point start = chrono::steady_clock::now();
+            parallelQuickSort(bids, pool);
+            chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+            cout << bids.size() << " bids sorted on " << pool.Size() << " threads" << endl;
+            cout << "time: " << elapsed.count() << " seconds" << endl;
+
+            break;
+        }
+
+        case 7:
+            // stable sort on title
+            ticks = clock();
+            mergeSort(bids);
+            ticks = clock() - ticks;
+
+            cout << bids.size() << " bids sorted" << endl;
+            cout << "time: " << ticks << " clock ticks" << endl;
+            cout << "time: " << ticks * 1.0 / CLOCKS_PER_SEC << " seconds" << endl;
+
+            break;
+
+        case 8:
+            // two stable passes: title, then fund
+            ticks = clock();
+            sortByFundThenTitle(bids);
+            ticks = clock() - ticks;
+
+            cout << bids.size() << " bids sorted" << endl;
+            cout << "time: " << ticks << " clock ticks" << endl;
+            cout << "time: " << ticks * 1.0 / CLOCKS_PER_SEC << " seconds" << endl;
+
+            break;
+
+        case 10:
+            // sort a permutation of the bids by title, then move each bid once
+            ticks = clock();
+            indirectSort(bids, &Bid::title);
+            ticks = clock() - ticks;
+
+            cout << bids.size() << " bids sorted" << endl;
+            cout << "time: " << ticks << " clock ticks" << endl;
+            cout << "time: " << ticks * 1.0 / CLOCKS_PER_SEC << " seconds" << endl;
+
+            break;
+
+        case 11: {
+            string key;
+            cout << "Sort key (title, fund, amount, id, date): ";
+            cin >> key;
+
+            ticks = clock();
+            if (key == "title") {
+                radixSort(bids, &Bid::title);
+            }
+            else if (key == "fund") {
+                radixSort(bids, &Bid::fund);
+            }
+            else if (key == "amount") {
+                numericSort(bids, NumericKey::Amount);
+            }
+            else if (key == "id") {
+                numericSort(bids, NumericKey::BidId);
+            }
+            else if (key == "date") {
+                numericSort(bids, NumericKey::CloseDate);
+            }
+            else {
+                cout << "Unknown sort key " << key << endl;
+                break;
+            }
+            ticks = clock() - ticks;
+
+            cout << bids.size() << " bids sorted" << endl;
+            cout << "time: " << ticks << " clock ticks" << endl;
+            cout << "time: " << ticks * 1.0 / CLOCKS_PER_SEC << " seconds" << endl;
+
+            break;
+        }
+
+        case 12: {
+            // sort the file by title on disk, holding at most the budget in memory
+            size_t budgetMB;
+            string outputPath;
+            cout << "Memory budget (MB): ";
+            cin >> budgetMB;
+            cout << "Output file: ";
+            cin >> outputPath;
+
+            try {
+                ExternalSort sorter(TitleLess(), budgetMB * 1024 * 1024);
+                chrono::steady_clock::time_point start = chrono::steady_clock::now();
+                size_t sorted = sorter.SortToFile(csvPath, outputPath);
+                chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+                cout << sorted << " bids sorted into " << outputPath << " from "
+                    << sorter.RunCount() << " runs in " << sorter.MergePasses() << " merge passes" << endl;
+                cout << "time: " << elapsed.count() << " seconds" << endl;
+            }
+            catch (const exception& e) {
+                cerr << e.what() << endl;
+            }
+
+            break;
+        }
+
+        case 13: {
+            // stream the file, keeping only the best k bids
+            size_t k;
+            string key;
+            cout << "Number of bids: ";
+            cin >> k;
+            cout << "Rank by (amount, title, fund): ";
+            cin >> key;
+
+            try {
+                ticks = clock();
+                vector<Bid> top;
+                if (key == "amount") {
+                    top = loadTopBids(csvPath, k, AmountGreater());
+                }
+                else if (key == "title") {
+                    top = loadTopBids(csvPath, k, TitleLess());
+                }
+                else if (key == "fund") {
+                    top = loadTopBids(csvPath, k, FundLess());
+                }
+                else {
+                    cout << "Unknown ranking " << key << endl;
+                    break;
+                }
+                ticks = clock() - ticks;
+
+                for (const Bid& bid : top) {
+                    displayBid(bid);
+                }
+                cout << top.size() << " bids kept" << endl;
+                cout << "time: " << ticks << " clock ticks" << endl;
+                cout << "time: " << ticks * 1.0 / CLOCKS_PER_SEC << " seconds" << endl;
+            }
+            catch (const exception& e) {
+                cerr << e.what() << endl;
+            }
+
+            break;
+        }
+
+        case 14: {
+            string keys;
+            cout << "Sort keys, \"-\" for largest first (";
+            for (size_t i = 0; i < sizeof(REPORT_ORDERS) / sizeof(REPORT_ORDERS[0]); ++i) {
+                cout << (i == 0 ? "" : "; ") << REPORT_ORDERS[i].keys;
+            }
+            cout << "): ";
+            cin >> keys;
+
+            ticks = clock();
+            if (!sortByKeys(bids, keys)) {
+                cout << "Unknown sort keys " << keys << endl;
+                break;
+            }
+            ticks = clock() - ticks;
+
+            cout << bids.size() << " bids sorted" << endl;
+            cout << "time: " << ticks << " clock ticks" << endl;
+            cout << "time: " << ticks * 1.0 / CLOCKS_PER_SEC << " seconds" << endl;
+
+            break;
+        }
+
+        case 15: {
+            string key;
+            cout << "Sort key (id, title, fund, date, amount): ";
+            cin >> key;
+
+            BidColumns::Field field;
+            if (key == "id") {
+                field = BidColumns::ID;
+            }
+            else if (key == "title") {
+                field = BidColumns::TITLE;
+            }
+            else if (key == "fund") {
+                field = BidColumns::FUND;
+            }
+            else if (key == "date") {
+                field = BidColumns::CLOSE_DATE;
+            }
+            else if (key == "amount") {
+                field = BidColumns::AMOUNT;
+            }
+            else {
+                cout << "Unknown sort key " << key << endl;
+                break;
+            }
+
+            // copy the bids into columns, sort the columns, and read the bids back in order
+            ticks = clock();
+            BidColumns columns(bids);
+            columns.SortBy(field);
+            bids = columns.ToBids();
+            ticks = clock() - ticks;
+
+            cout << bids.size() << " bids sorted" << endl;
+            cout << "time: " << ticks << " clock ticks" << endl;
+            cout << "time: " << ticks * 1.0 / CLOCKS_PER_SEC << " seconds" << endl;
+
+            break;
+        }
+        
+		case 9:
+			// Exit the program
+			cout << "Exiting program..." << endl;
+            break;
+
+        default:
+			cout << "Invalid choice, please try again." << endl;
+			
+
+
+        }
+    }
+
+    cout << "Good bye." << endl;
+
+    return 0;
+}